@@ -0,0 +1,245 @@
+/** \file
+ * Host simulation of the ADC filter with made up sample streams.
+ *
+ *	make adc-filter-sim
+ *	./adc-filter-sim
+ *
+ * A free running ADC is modelled with the same channel pipeline as
+ * the hardware: each conversion uses the MUX setting from when it
+ * started, which is before the interrupt for the previous one ran.
+ * The streams check that steady inputs come out exactly and on the
+ * right channel, and measure how much noise and single sample spikes
+ * are reduced and how long a step takes to settle.
+ *
+ * Exits non-zero if any of the exact checks fail.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "adc_filter.h"
+#include "xorshift.h"
+
+/** 16 MHz / 128 / 13 cycles per conversion */
+#define SAMPLE_HZ	9615
+
+typedef uint16_t (*signal_t)(uint8_t chan, uint32_t k);
+
+static xorshift_t rng;
+static uint16_t level[ADC_CHANNELS];
+static uint32_t step_at;
+static int failed;
+
+
+static uint16_t
+signal_const(
+	const uint8_t chan,
+	const uint32_t k
+)
+{
+	(void) k;
+	return level[chan];
+}
+
+
+static uint16_t
+signal_noise(
+	const uint8_t chan,
+	const uint32_t k
+)
+{
+	(void) k;
+	return level[chan] - 32 + xorshift_below(&rng, 65);
+}
+
+
+static uint16_t
+signal_step(
+	const uint8_t chan,
+	const uint32_t k
+)
+{
+	if (chan != 0)
+		return level[chan];
+	return k < step_at ? 100 : 900;
+}
+
+
+static uint16_t
+signal_spike(
+	const uint8_t chan,
+	const uint32_t k
+)
+{
+	if (k % 500 == 499)
+		return 1023;
+	return level[chan];
+}
+
+
+/** Callback for each published set of readings */
+typedef void (*publish_t)(uint32_t k, const uint16_t * out);
+
+
+/** Run the ADC for n conversions */
+static void
+simulate(
+	signal_t signal,
+	const uint32_t n,
+	publish_t publish
+)
+{
+	adc_filter_t f;
+	uint16_t out[ADC_CHANNELS];
+
+	adc_filter_init(&f);
+
+	uint8_t mux_reg = f.mux;
+	uint8_t running = mux_reg;
+
+	for (uint32_t k = 0 ; k < n ; k++)
+	{
+		const uint16_t sample = signal(running, k);
+
+		// the next conversion starts before the interrupt runs
+		const uint8_t next = mux_reg;
+
+		const uint8_t chan = adc_filter_advance(&f);
+		mux_reg = f.mux;
+
+		if (chan != running)
+		{
+			printf("FAIL: sample %u from channel %u filed as %u\n",
+				k, running, chan);
+			failed = 1;
+			return;
+		}
+
+		if (adc_filter_sample(&f, chan, sample))
+		{
+			adc_filter_read(&f, out);
+			publish(k, out);
+		}
+
+		running = next;
+	}
+}
+
+
+static uint16_t expect[ADC_CHANNELS];
+static uint32_t mismatches;
+static uint32_t publishes;
+
+static void
+publish_exact(
+	const uint32_t k,
+	const uint16_t * const out
+)
+{
+	(void) k;
+	publishes++;
+	for (uint8_t i = 0 ; i < ADC_CHANNELS ; i++)
+		if (out[i] != expect[i])
+			mismatches++;
+}
+
+
+static void
+check_const(
+	const uint16_t a,
+	const uint16_t b
+)
+{
+	level[0] = expect[0] = a;
+	level[1] = expect[1] = b;
+	mismatches = publishes = 0;
+
+	simulate(signal_const, SAMPLE_HZ, publish_exact);
+
+	const int ok = mismatches == 0 && publishes != 0;
+	printf("%s: constant %4u %4u, %u readings\n",
+		ok ? "ok  " : "FAIL",
+		a,
+		b,
+		publishes
+	);
+	if (!ok)
+		failed = 1;
+}
+
+
+static double sum;
+static double sum2;
+static uint16_t worst;
+
+static void
+publish_stats(
+	const uint32_t k,
+	const uint16_t * const out
+)
+{
+	(void) k;
+	publishes++;
+	sum += out[0];
+	sum2 += (double) out[0] * out[0];
+
+	const uint16_t d = abs(out[0] - level[0]);
+	if (worst < d)
+		worst = d;
+}
+
+
+static uint32_t settled_at;
+
+static void
+publish_step(
+	const uint32_t k,
+	const uint16_t * const out
+)
+{
+	if (k < step_at)
+		return;
+	if (abs(out[0] - 900) > 1)
+		settled_at = 0;
+	else
+	if (settled_at == 0)
+		settled_at = k;
+}
+
+
+int
+main(void)
+{
+	xorshift_seed(&rng, 1);
+
+	check_const(0, 0);
+	check_const(512, 512);
+	check_const(1023, 1023);
+	check_const(200, 800);
+	check_const(1023, 0);
+
+	// uniform noise of +/-32 counts has a deviation of 18.8
+	level[0] = level[1] = 512;
+	sum = sum2 = 0;
+	worst = publishes = 0;
+	simulate(signal_noise, SAMPLE_HZ * 10, publish_stats);
+	const double mean = sum / publishes;
+	printf("noise: +/-32 in, deviation %.2f out (18.76 in), worst %u\n",
+		sqrt(sum2 / publishes - mean * mean),
+		worst
+	);
+
+	step_at = SAMPLE_HZ;
+	settled_at = 0;
+	simulate(signal_step, SAMPLE_HZ * 2, publish_step);
+	printf("step: 100 to 900 within 1 count after %.1f ms\n",
+		(settled_at - step_at) * 1000.0 / SAMPLE_HZ
+	);
+
+	worst = publishes = 0;
+	sum = sum2 = 0;
+	simulate(signal_spike, SAMPLE_HZ * 10, publish_stats);
+	printf("spike: 1023 every 500 samples on 512, worst error %u\n", worst);
+
+	return failed;
+}
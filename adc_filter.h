@@ -0,0 +1,160 @@
+/** \file
+ * Oversampling and filtering for a free running ADC.
+ *
+ * The ADC interrupt hands every conversion to adc_filter_sample().
+ * Each channel sums 1 << ADC_OVERSAMPLE_BITS samples, which gives
+ * two more bits of resolution and averages out the sampling noise,
+ * and the sums go through a first order low pass filter to steady the
+ * readings between samples.  When every channel has a new value they
+ * are published to the front buffer, so the main loop only has to
+ * copy the latest readings.
+ *
+ * Nothing here touches the hardware, so the filter can be run on the
+ * host with made up sample streams.
+ */
+#ifndef _adc_filter_h_
+#define _adc_filter_h_
+
+#include <stdint.h>
+
+#ifndef ADC_CHANNELS
+#define ADC_CHANNELS		2
+#endif
+
+/** Samples summed per channel for each filter update */
+#ifndef ADC_OVERSAMPLE_BITS
+#define ADC_OVERSAMPLE_BITS	4
+#endif
+
+/** Low pass time constant of 1 << ADC_FILTER_SHIFT updates */
+#ifndef ADC_FILTER_SHIFT
+#define ADC_FILTER_SHIFT	1
+#endif
+
+/** The filter state keeps the extra bits from oversampling */
+#define ADC_FRAC_BITS		ADC_OVERSAMPLE_BITS
+
+
+typedef struct
+{
+	// written only by the interrupt
+	uint8_t mux; // channel selected for the next conversion
+	uint8_t pending; // channel of the conversion now running
+	uint8_t count[ADC_CHANNELS];
+	uint16_t sum[ADC_CHANNELS];
+	uint16_t state[ADC_CHANNELS]; // 10 bits + ADC_FRAC_BITS
+	uint8_t ready; // channels updated since the last publish
+	uint8_t primed;
+
+	// shared with the reader
+	uint16_t out[2][ADC_CHANNELS];
+	volatile uint8_t front;
+	volatile uint8_t seq;
+} adc_filter_t;
+
+
+static inline void
+adc_filter_init(
+	adc_filter_t * const f
+)
+{
+	f->mux = 0;
+	f->pending = 0;
+	f->ready = 0;
+	f->primed = 0;
+	f->front = 0;
+	f->seq = 0;
+
+	for (uint8_t i = 0 ; i < ADC_CHANNELS ; i++)
+	{
+		f->count[i] = 0;
+		f->sum[i] = 0;
+		f->state[i] = 0;
+		f->out[0][i] = f->out[1][i] = 0;
+	}
+}
+
+
+/** Channel bookkeeping for free running mode.
+ * By the time the interrupt runs the next conversion has already
+ * started, so a new MUX setting only applies to the one after that.
+ * Returns the channel of the sample that just completed and leaves
+ * f->mux as the channel to select now.
+ */
+static inline uint8_t
+adc_filter_advance(
+	adc_filter_t * const f
+)
+{
+	const uint8_t chan = f->pending;
+	f->pending = f->mux;
+	f->mux = f->mux + 1 == ADC_CHANNELS ? 0 : f->mux + 1;
+	return chan;
+}
+
+
+/** Add one 10-bit sample.
+ * Returns 1 when a new set of readings has been published.
+ */
+static inline uint8_t
+adc_filter_sample(
+	adc_filter_t * const f,
+	const uint8_t chan,
+	const uint16_t sample
+)
+{
+	f->sum[chan] += sample;
+	if (++f->count[chan] != 1 << ADC_OVERSAMPLE_BITS)
+		return 0;
+
+	// the sum is the mean with ADC_OVERSAMPLE_BITS of fraction
+	const uint16_t x = f->sum[chan];
+	f->sum[chan] = 0;
+	f->count[chan] = 0;
+
+	if (f->primed & (1 << chan))
+		f->state[chan] += ((int16_t) (x - f->state[chan])) >> ADC_FILTER_SHIFT;
+	else
+		f->state[chan] = x;
+	f->primed |= 1 << chan;
+
+	const uint8_t back = !f->front;
+	f->out[back][chan] = (f->state[chan] + (1 << (ADC_FRAC_BITS - 1))) >> ADC_FRAC_BITS;
+
+	f->ready |= 1 << chan;
+	if (f->ready != (1 << ADC_CHANNELS) - 1)
+		return 0;
+
+	// the back buffer is complete, swap it with the front;
+	// every channel is rewritten before the next swap
+	f->ready = 0;
+	f->front = back;
+	f->seq++;
+
+	return 1;
+}
+
+
+/** Copy the latest readings.
+ * Retries if a new set was published while copying, so the values
+ * always come from the same set without disabling interrupts.
+ */
+static inline void
+adc_filter_read(
+	const adc_filter_t * const f,
+	uint16_t * const out
+)
+{
+	uint8_t seq;
+
+	do {
+		seq = f->seq;
+		__asm__ __volatile__("" ::: "memory");
+		const uint8_t front = f->front;
+		for (uint8_t i = 0 ; i < ADC_CHANNELS ; i++)
+			out[i] = f->out[front][i];
+		__asm__ __volatile__("" ::: "memory");
+	} while (seq != f->seq);
+}
+
+#endif
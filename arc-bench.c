@@ -0,0 +1,346 @@
+/** \file
+ * Host check and cost of the circle, ellipse and arc primitives.
+ *
+ *	make arc-bench
+ *	./arc-bench
+ *
+ * vector.c is linked in with the DAC ports and _delay_us() provided
+ * here, so every position of the beam is recorded.  Every ellipse
+ * with radii up to VECTOR_ARC_MAX is drawn and must be a closed path
+ * of 8-connected steps, each within a pixel of the exact ellipse.
+ * Random arcs must stay inside their start and end rays and begin
+ * and end on them, to within a pixel and a half; only arcs shorter
+ * than that may draw nothing.
+ *
+ * Exits non-zero if any of them fail.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "vector.h"
+#include "fixmath.h"
+
+volatile uint8_t PORTB;
+volatile uint8_t PORTD;
+
+/** Longest path, all the way round the largest circle */
+#define MAX_TRACE	4096
+
+static uint8_t trace_x[MAX_TRACE];
+static uint8_t trace_y[MAX_TRACE];
+static unsigned trace_len;
+static unsigned long steps;
+static double scope_us;
+
+
+/** Called by vector.c for every move and step of the beam */
+void
+_delay_us(
+	double us
+)
+{
+	scope_us += us;
+	if (us == 5 || us == 7)
+		steps++;
+
+	if (trace_len < MAX_TRACE)
+	{
+		trace_x[trace_len] = PORTB;
+		trace_y[trace_len] = PORTD;
+		trace_len++;
+	}
+}
+
+
+/** Start a new trace with the beam away from anything drawn, so that
+ * the first moveto() is recorded.
+ */
+static void
+trace_start(void)
+{
+	PORTB = 0;
+	PORTD = 0;
+	trace_len = 0;
+}
+
+
+static double
+now_ns(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+
+/** Distance of a point from an ellipse centred on the origin, by
+ * bisection for the closest point as in Eberly's "Distance from a
+ * Point to an Ellipse".
+ */
+static double
+ellipse_dist(
+	double x,
+	double y,
+	double rx,
+	double ry
+)
+{
+	x = fabs(x);
+	y = fabs(y);
+
+	// the longer axis along x
+	if (rx < ry)
+	{
+		double t = rx; rx = ry; ry = t;
+		t = x; x = y; y = t;
+	}
+
+	if (y == 0)
+	{
+		const double numer = rx * x;
+		const double denom = rx * rx - ry * ry;
+		if (numer >= denom)
+			return fabs(x - rx);
+		const double xr = numer / denom;
+		const double cx = rx * xr;
+		const double cy = ry * sqrt(1 - xr * xr);
+		return hypot(cx - x, cy);
+	}
+
+	if (x == 0)
+		return fabs(y - ry);
+
+	const double z0 = x / rx;
+	const double z1 = y / ry;
+	const double g = z0 * z0 + z1 * z1 - 1;
+	if (g == 0)
+		return 0;
+
+	// the root s of (r z0 / (s + r))^2 + (z1 / (s + 1))^2 = 1
+	const double r = (rx / ry) * (rx / ry);
+	const double n0 = r * z0;
+	double s0 = z1 - 1;
+	double s1 = g < 0 ? 0 : hypot(n0, z1) - 1;
+	double s = 0;
+
+	for (unsigned i = 0 ; i < 200 ; i++)
+	{
+		s = (s0 + s1) / 2;
+		if (s == s0 || s == s1)
+			break;
+		const double a = n0 / (s + r);
+		const double b = z1 / (s + 1);
+		const double h = a * a + b * b - 1;
+		if (h > 0)
+			s0 = s;
+		else
+		if (h < 0)
+			s1 = s;
+		else
+			break;
+	}
+
+	return hypot(r * x / (s + r) - x, y / (s + 1) - y);
+}
+
+
+static int
+check_ellipses(void)
+{
+	unsigned long broken = 0;
+	unsigned long open = 0;
+	double worst = 0;
+	unsigned worst_rx = 0;
+	unsigned worst_ry = 0;
+
+	for (unsigned rx = 1 ; rx <= VECTOR_ARC_MAX ; rx++)
+	{
+		for (unsigned ry = 1 ; ry <= VECTOR_ARC_MAX ; ry++)
+		{
+			trace_start();
+			ellipse(128, 128, rx, ry);
+
+			for (unsigned i = 0 ; i < trace_len ; i++)
+			{
+				const int x = trace_x[i];
+				const int y = trace_y[i];
+				const double d = ellipse_dist(x - 128, y - 128, rx, ry);
+				if (d > worst)
+				{
+					worst = d;
+					worst_rx = rx;
+					worst_ry = ry;
+				}
+
+				if (i == 0)
+					continue;
+				if (abs(x - trace_x[i - 1]) > 1
+				||  abs(y - trace_y[i - 1]) > 1)
+					broken++;
+			}
+
+			if (abs(trace_x[0] - trace_x[trace_len - 1]) > 1
+			||  abs(trace_y[0] - trace_y[trace_len - 1]) > 1)
+				open++;
+		}
+	}
+
+	const int failed = broken || open || worst > 1;
+	printf("%s: ellipses up to %u: %lu gaps, %lu open, worst %.2f px at %ux%u\n",
+		failed ? "FAIL" : "ok  ",
+		VECTOR_ARC_MAX,
+		broken,
+		open,
+		worst,
+		worst_rx,
+		worst_ry
+	);
+
+	return failed;
+}
+
+
+/** How far a point is outside the anticlockwise sector from the
+ * start to the end ray, in pixels.
+ */
+static double
+sector_dist(
+	const double x,
+	const double y,
+	const double t0,
+	const double t1
+)
+{
+	const double span = fmod(t1 - t0 + 4 * M_PI, 2 * M_PI);
+	const double t = fmod(atan2(y, x) - t0 + 4 * M_PI, 2 * M_PI);
+	if (t <= span)
+		return 0;
+
+	// past one of the rays; the distance to whichever is nearer
+	const double d0 = fabs(cos(t0) * y - sin(t0) * x);
+	const double d1 = fabs(cos(t1) * y - sin(t1) * x);
+	return d0 < d1 ? d0 : d1;
+}
+
+
+static double
+ray_dist(
+	const double x,
+	const double y,
+	const double t
+)
+{
+	return fabs(cos(t) * y - sin(t) * x);
+}
+
+
+static int
+check_arcs(void)
+{
+	const unsigned n = 3000;
+	unsigned long outside = 0;
+	unsigned long ends = 0;
+	double worst = 0;
+
+	srand(1);
+
+	for (unsigned i = 0 ; i < n ; i++)
+	{
+		const uint8_t rx = 8 + rand() % (VECTOR_ARC_MAX - 7);
+		const uint8_t ry = 8 + rand() % (VECTOR_ARC_MAX - 7);
+		const uint16_t start = rand();
+		uint16_t end = rand();
+		if (end == start)
+			end++;
+
+		vector_arc_t a;
+		vector_arc_init(&a, 128, 128, rx, ry, start, end);
+		trace_start();
+		arc(&a);
+
+		// the angles are those of the rays from the centre
+		const double t0 = start * 2 * M_PI / 65536;
+		const double t1 = end * 2 * M_PI / 65536;
+
+		for (unsigned j = 0 ; j < trace_len ; j++)
+		{
+			const double d = sector_dist(trace_x[j] - 128, trace_y[j] - 128, t0, t1);
+			if (d > worst)
+				worst = d;
+			if (d > 1.5)
+				outside++;
+		}
+
+		// arcs shorter than a pixel or so may draw nothing
+		if (trace_len == 0)
+		{
+			const double span = fmod(t1 - t0 + 4 * M_PI, 2 * M_PI);
+			const double t = t0 + span / 2;
+			const double r = 1 / hypot(cos(t) / rx, sin(t) / ry);
+			if (span * r > 1.5)
+				ends++;
+			continue;
+		}
+
+		if (ray_dist(trace_x[0] - 128, trace_y[0] - 128, t0) > 1.5
+		||  ray_dist(trace_x[trace_len - 1] - 128, trace_y[trace_len - 1] - 128, t1) > 1.5)
+			ends++;
+	}
+
+	const int failed = outside || ends;
+	printf("%s: %u random arcs: %lu steps outside, worst %.2f px, %lu bad ends\n",
+		failed ? "FAIL" : "ok  ",
+		n,
+		outside,
+		worst,
+		ends
+	);
+
+	return failed;
+}
+
+
+static void
+costs(
+	const uint8_t r
+)
+{
+	const unsigned n = 4096;
+
+	steps = 0;
+	scope_us = 0;
+
+	const double t0 = now_ns();
+	for (unsigned i = 0 ; i < n ; i++)
+	{
+		trace_start();
+		circle(128, 128, r);
+	}
+	const double t1 = now_ns();
+
+	printf("circle r=%3u: %5lu steps, %6.2f ms on the scope, %6.0f ns on the host\n",
+		r,
+		steps / n,
+		scope_us / n / 1000,
+		(t1 - t0) / n
+	);
+}
+
+
+int
+main(void)
+{
+	int failed = 0;
+
+	failed |= check_ellipses();
+	failed |= check_arcs();
+
+	printf("\n");
+	costs(16);
+	costs(64);
+	costs(124);
+
+	return failed;
+}
@@ -0,0 +1,106 @@
+/** \file
+ * Bounding boxes of the asteroids font glyphs.
+ *
+ * Generated by "./fontgen bbox"; do not edit by hand.
+ */
+#include <stdint.h>
+#include "memspaces.h"
+#include "asteroids-font.h"
+
+const PROGMEM glyph_bbox_t asteroids_font_bbox[] = {
+	{   0,   0,  -1,  -1, }, /* Ascii 32 */
+	{   6,   0,  10,  24, }, /* Ascii 33 */
+	{   4,  12,  12,  20, }, /* Ascii 34 */
+	{   0,   4,  16,  20, }, /* Ascii 35 */
+	{   4,   0,  12,  24, }, /* Ascii 36 */
+	{   0,   0,  16,  24, }, /* Ascii 37 */
+	{   0,   0,  16,  24, }, /* Ascii 38 */
+	{   4,  12,  12,  20, }, /* Ascii 39 */
+	{   4,   0,  12,  24, }, /* Ascii 40 */
+	{   4,   0,  12,  24, }, /* Ascii 41 */
+	{   0,   0,  16,  24, }, /* Ascii 42 */
+	{   2,   6,  14,  18, }, /* Ascii 43 */
+	{   4,   0,   8,   4, }, /* Ascii 44 */
+	{   4,  12,  12,  12, }, /* Ascii 45 */
+	{   6,   0,   8,   0, }, /* Ascii 46 */
+	{   0,   0,  16,  24, }, /* Ascii 47 */
+	{   0,   0,  16,  24, }, /* Ascii 48 */
+	{   6,   0,   8,  24, }, /* Ascii 49 */
+	{   0,   0,  16,  24, }, /* Ascii 50 */
+	{   0,   0,  16,  24, }, /* Ascii 51 */
+	{   0,   0,  16,  24, }, /* Ascii 52 */
+	{   0,   0,  16,  24, }, /* Ascii 53 */
+	{   0,   0,  16,  24, }, /* Ascii 54 */
+	{   0,   0,  16,  24, }, /* Ascii 55 */
+	{   0,   0,  16,  24, }, /* Ascii 56 */
+	{   0,   0,  16,  24, }, /* Ascii 57 */
+	{   8,   6,   8,  18, }, /* Ascii 58 */
+	{   2,   4,   8,  18, }, /* Ascii 59 */
+	{   4,   0,  12,  24, }, /* Ascii 60 */
+	{   2,   8,  14,  16, }, /* Ascii 61 */
+	{   4,   0,  12,  24, }, /* Ascii 62 */
+	{   0,   0,  16,  24, }, /* Ascii 63 */
+	{   0,   0,  16,  24, }, /* Ascii 64 */
+	{   0,   0,  16,  24, }, /* Ascii 65 */
+	{   0,   0,  16,  24, }, /* Ascii 66 */
+	{   0,   0,  16,  24, }, /* Ascii 67 */
+	{   0,   0,  16,  24, }, /* Ascii 68 */
+	{   0,   0,  16,  24, }, /* Ascii 69 */
+	{   0,   0,  16,  24, }, /* Ascii 70 */
+	{   0,   0,  16,  24, }, /* Ascii 71 */
+	{   0,   0,  16,  24, }, /* Ascii 72 */
+	{   0,   0,  16,  24, }, /* Ascii 73 */
+	{   0,   0,  16,  24, }, /* Ascii 74 */
+	{   0,   0,  16,  24, }, /* Ascii 75 */
+	{   0,   0,  16,  24, }, /* Ascii 76 */
+	{   0,   0,  16,  24, }, /* Ascii 77 */
+	{   0,   0,  16,  24, }, /* Ascii 78 */
+	{   0,   0,  16,  24, }, /* Ascii 79 */
+	{   0,   0,  16,  24, }, /* Ascii 80 */
+	{   0,   0,  16,  24, }, /* Ascii 81 */
+	{   0,   0,  16,  24, }, /* Ascii 82 */
+	{   0,   0,  16,  24, }, /* Ascii 83 */
+	{   0,   0,  16,  24, }, /* Ascii 84 */
+	{   0,   0,  16,  24, }, /* Ascii 85 */
+	{   0,   0,  16,  24, }, /* Ascii 86 */
+	{   0,   0,  16,  24, }, /* Ascii 87 */
+	{   0,   0,  16,  24, }, /* Ascii 88 */
+	{   0,   0,  16,  24, }, /* Ascii 89 */
+	{   0,   0,  16,  24, }, /* Ascii 90 */
+	{   4,   0,  12,  24, }, /* Ascii 91 */
+	{   0,   0,  16,  24, }, /* Ascii 92 */
+	{   4,   0,  12,  24, }, /* Ascii 93 */
+	{   4,  12,  12,  24, }, /* Ascii 94 */
+	{   0,   0,  16,   0, }, /* Ascii 95 */
+	{   4,  12,  12,  20, }, /* Ascii 96 */
+	{   0,   0,   0,   0, }, /* Ascii 97 */
+	{   0,   0,   0,   0, }, /* Ascii 98 */
+	{   0,   0,   0,   0, }, /* Ascii 99 */
+	{   0,   0,   0,   0, }, /* Ascii 100 */
+	{   0,   0,   0,   0, }, /* Ascii 101 */
+	{   0,   0,   0,   0, }, /* Ascii 102 */
+	{   0,   0,   0,   0, }, /* Ascii 103 */
+	{   0,   0,   0,   0, }, /* Ascii 104 */
+	{   0,   0,   0,   0, }, /* Ascii 105 */
+	{   0,   0,   0,   0, }, /* Ascii 106 */
+	{   0,   0,   0,   0, }, /* Ascii 107 */
+	{   0,   0,   0,   0, }, /* Ascii 108 */
+	{   0,   0,   0,   0, }, /* Ascii 109 */
+	{   0,   0,   0,   0, }, /* Ascii 110 */
+	{   0,   0,   0,   0, }, /* Ascii 111 */
+	{   0,   0,   0,   0, }, /* Ascii 112 */
+	{   0,   0,   0,   0, }, /* Ascii 113 */
+	{   0,   0,   0,   0, }, /* Ascii 114 */
+	{   0,   0,   0,   0, }, /* Ascii 115 */
+	{   0,   0,   0,   0, }, /* Ascii 116 */
+	{   0,   0,   0,   0, }, /* Ascii 117 */
+	{   0,   0,   0,   0, }, /* Ascii 118 */
+	{   0,   0,   0,   0, }, /* Ascii 119 */
+	{   0,   0,   0,   0, }, /* Ascii 120 */
+	{   0,   0,   0,   0, }, /* Ascii 121 */
+	{   0,   0,   0,   0, }, /* Ascii 122 */
+	{   4,   0,  12,  24, }, /* Ascii 123 */
+	{   8,   0,   8,  24, }, /* Ascii 124 */
+	{   8,   0,  16,  24, }, /* Ascii 125 */
+	{   0,   8,  16,  16, }, /* Ascii 126 */
+};
@@ -5,6 +5,7 @@
 #define _asteroids_font_h_
 
 #include <stdint.h>
+#include "font.h"
 
 typedef struct
 {
@@ -14,5 +15,8 @@ typedef struct
 
 extern const asteroids_char_t asteroids_font[];
 
+/** Glyph extents after decoding, generated by "./fontgen bbox" */
+extern const glyph_bbox_t asteroids_font_bbox[];
+
 
 #endif
@@ -21,6 +21,8 @@ static void
 now_update(void)
 #endif
 {
+	now++;
+
 	if (now_ms < 999)
 	{
 		now_ms += 1;
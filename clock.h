@@ -8,6 +8,7 @@
 #define _clock_h_
 
 #include <avr/io.h>
+#include <avr/interrupt.h>
 #include <stdint.h>
 
 /** Track the number of miliseconds, sec, min and hour since midnight */
@@ -22,4 +23,37 @@ void
 clock_init(void);
 
 
+/** Read the ms counter without racing the timer interrupt */
+static inline uint16_t
+clock_now(void)
+{
+	const uint8_t sreg = SREG;
+	cli();
+	const uint16_t t = now;
+	SREG = sreg;
+	return t;
+}
+
+
+/** Read the seconds since midnight and the ms into this second
+ * without racing the timer interrupt.
+ */
+static inline uint32_t
+clock_time_of_day(
+	uint16_t * const ms_out
+)
+{
+	const uint8_t sreg = SREG;
+	cli();
+	const uint8_t h = now_hour;
+	const uint8_t m = now_min;
+	const uint8_t s = now_sec;
+	const uint16_t ms = now_ms;
+	SREG = sreg;
+
+	*ms_out = ms;
+	return (h * 60UL + m) * 60 + s;
+}
+
+
 #endif
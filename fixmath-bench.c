@@ -0,0 +1,332 @@
+/** \file
+ * Host accuracy and cost of the fixed point math.
+ *
+ *	make fixmath-bench
+ *	./fixmath-bench
+ *
+ * Every function is compared against the double precision libm
+ * result, exhaustively where the input space allows, and timed over
+ * the same inputs.  The cost is reported in host nanoseconds and, on
+ * x86, time stamp counter cycles per call.  The AVR has no barrel
+ * shifter and only an 8x8 multiplier, so the relative costs there
+ * differ: the CORDIC loop's 32-bit shifts are much dearer than on the
+ * host, while the table lookups are not.
+ *
+ * The old 8-bit sin_lookup() is included for comparison.
+ *
+ * Exits non-zero if fix_isqrt() is ever wrong or any error is over
+ * its bound.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "fixmath.h"
+#include "sin_table.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC
+#endif
+
+static int failed;
+
+/** Keeps the timed calls from being optimised away */
+static volatile uint32_t sink;
+
+
+typedef struct
+{
+	struct timespec t0;
+#ifdef HAVE_TSC
+	uint64_t c0;
+#endif
+} timer_t_;
+
+
+static void
+timer_start(
+	timer_t_ * const t
+)
+{
+	clock_gettime(CLOCK_MONOTONIC, &t->t0);
+#ifdef HAVE_TSC
+	t->c0 = __rdtsc();
+#endif
+}
+
+
+static void
+timer_report(
+	const timer_t_ * const t,
+	const char * const name,
+	const unsigned long calls
+)
+{
+	struct timespec t1;
+#ifdef HAVE_TSC
+	const uint64_t c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	const double ns = (t1.tv_sec - t->t0.tv_sec) * 1e9
+		+ (t1.tv_nsec - t->t0.tv_nsec);
+
+	printf("%-12s %8.2f ns", name, ns / calls);
+#ifdef HAVE_TSC
+	printf(" %8.1f cycles", (double) (c1 - t->c0) / calls);
+#endif
+	printf("\n");
+}
+
+
+static void
+check(
+	const char * const name,
+	const double worst,
+	const double rms,
+	const double bound,
+	const char * const unit
+)
+{
+	const int ok = worst <= bound;
+	printf("%s: %-12s worst %.3f rms %.3f %s\n",
+		ok ? "ok  " : "FAIL",
+		name,
+		worst,
+		rms,
+		unit
+	);
+	if (!ok)
+		failed = 1;
+}
+
+
+static void
+sin_accuracy(void)
+{
+	double worst = 0;
+	double sum2 = 0;
+
+	for (uint32_t a = 0 ; a < 0x10000 ; a++)
+	{
+		const double want = FIX_ONE * sin(a * 2 * M_PI / 65536);
+		const double e = fabs(fix_sin(a) - want);
+		sum2 += e * e;
+		if (e > worst)
+			worst = e;
+
+		const double ce = fabs(fix_cos(a) - FIX_ONE * cos(a * 2 * M_PI / 65536));
+		if (ce > worst)
+			worst = ce;
+	}
+
+	check("fix_sin", worst, sqrt(sum2 / 0x10000), 1.0, "Q14 lsb");
+
+	// sin_lookup() is 127 == 1.0, with 0 along +y
+	worst = sum2 = 0;
+	for (unsigned a = 0 ; a < 0x100 ; a++)
+	{
+		const double want = 127 * sin(a * 2 * M_PI / 256);
+		const double e = fabs(sin_lookup(a) - want) * FIX_ONE / 127;
+		sum2 += e * e;
+		if (e > worst)
+			worst = e;
+	}
+
+	check("sin_lookup", worst, sqrt(sum2 / 0x100), INFINITY, "Q14 lsb");
+}
+
+
+/** Angle error in 1/65536 of a turn, wrapped to +/- half a turn */
+static double
+angle_error(
+	const uint16_t got,
+	const double want
+)
+{
+	double e = got - want;
+	while (e > 32768)
+		e -= 65536;
+	while (e < -32768)
+		e += 65536;
+	return fabs(e);
+}
+
+
+static void
+polar_accuracy(void)
+{
+	double worst_a = 0;
+	double sum2_a = 0;
+	double worst_m = 0;
+	double sum2_m = 0;
+	double worst_s = 0;
+	double sum2_s = 0;
+	unsigned long n = 0;
+
+	// every direction at small lengths, and a grid over all of them
+	for (int32_t y = -32768 ; y < 32768 ; y += 97)
+	{
+		for (int32_t x = -32768 ; x < 32768 ; x += 89)
+		{
+			if (x == 0 && y == 0)
+				continue;
+
+			double want = atan2(y, x) * 65536 / (2 * M_PI);
+			if (want < 0)
+				want += 65536;
+
+			uint16_t mag;
+			const uint16_t angle = fix_polar(x, y, &mag);
+
+			const double ea = angle_error(angle, want);
+			sum2_a += ea * ea;
+			if (ea > worst_a)
+				worst_a = ea;
+
+			const double len = sqrt((double) x * x + (double) y * y);
+			const double em = fabs(mag - len);
+			sum2_m += em * em;
+			if (em > worst_m)
+				worst_m = em;
+
+			// isqrt of the sum of squares as the other way
+			// to get a length
+			const uint32_t r2 = (uint32_t) (x * x) + (uint32_t) (y * y);
+			if (r2 < 0xFFFFFFFF)
+			{
+				const double es = fabs(fix_isqrt(r2) - len);
+				sum2_s += es * es;
+				if (es > worst_s)
+					worst_s = es;
+			}
+
+			n++;
+		}
+	}
+
+	for (int32_t y = -64 ; y <= 64 ; y++)
+	{
+		for (int32_t x = -64 ; x <= 64 ; x++)
+		{
+			if (x == 0 && y == 0)
+				continue;
+
+			double want = atan2(y, x) * 65536 / (2 * M_PI);
+			if (want < 0)
+				want += 65536;
+
+			const double ea = angle_error(fix_atan2(y, x), want);
+			if (ea > worst_a)
+				worst_a = ea;
+
+			const double em = fabs(fix_hypot(x, y) - sqrt(x * x + y * y));
+			if (em > worst_m)
+				worst_m = em;
+		}
+	}
+
+	check("fix_atan2", worst_a, sqrt(sum2_a / n), 2.0, "angle units");
+	check("fix_hypot", worst_m, sqrt(sum2_m / n), 1.0, "units");
+	check("isqrt hypot", worst_s, sqrt(sum2_s / n), 1.0, "units");
+}
+
+
+static void
+isqrt_accuracy(void)
+{
+	unsigned long wrong = 0;
+
+	// exhaustive near every perfect square, and a sweep of the rest
+	for (uint32_t r = 0 ; r < 0x10000 ; r++)
+	{
+		const uint32_t sq = r * r;
+		if (fix_isqrt(sq) != r)
+			wrong++;
+		if (sq && fix_isqrt(sq - 1) != r - 1)
+			wrong++;
+	}
+
+	for (uint64_t x = 0 ; x <= 0xFFFFFFFF ; x += 65521)
+	{
+		const uint32_t want = floor(sqrt((double) x));
+		if (fix_isqrt(x) != want)
+			wrong++;
+	}
+
+	if (fix_isqrt(0xFFFFFFFF) != 0xFFFF)
+		wrong++;
+
+	printf("%s: fix_isqrt    %lu wrong\n", wrong ? "FAIL" : "ok  ", wrong);
+	if (wrong)
+		failed = 1;
+}
+
+
+static void
+costs(void)
+{
+	const unsigned long n = 1 << 22;
+	timer_t_ t;
+	uint32_t acc = 0;
+
+	printf("\n");
+
+	timer_start(&t);
+	for (unsigned long i = 0 ; i < n ; i++)
+		acc += fix_sin(i * 40503);
+	timer_report(&t, "fix_sin", n);
+
+	timer_start(&t);
+	for (unsigned long i = 0 ; i < n ; i++)
+		acc += sin_lookup(i * 157);
+	timer_report(&t, "sin_lookup", n);
+
+	timer_start(&t);
+	for (unsigned long i = 0 ; i < n ; i++)
+		acc += lrint(FIX_ONE * sin((i * 40503 & 0xFFFF) * (2 * M_PI / 65536)));
+	timer_report(&t, "libm sin", n);
+
+	timer_start(&t);
+	for (unsigned long i = 0 ; i < n ; i++)
+		acc += fix_atan2(i * 7919, i * 104729);
+	timer_report(&t, "fix_atan2", n);
+
+	timer_start(&t);
+	for (unsigned long i = 0 ; i < n ; i++)
+	{
+		uint16_t mag;
+		acc += fix_polar(i * 7919, i * 104729, &mag) + mag;
+	}
+	timer_report(&t, "fix_polar", n);
+
+	timer_start(&t);
+	for (unsigned long i = 0 ; i < n ; i++)
+	{
+		const int16_t x = i * 104729;
+		const int16_t y = i * 7919;
+		acc += fix_isqrt((uint32_t) (x * x) + (uint32_t) (y * y));
+	}
+	timer_report(&t, "isqrt hypot", n);
+
+	timer_start(&t);
+	for (unsigned long i = 0 ; i < n ; i++)
+		acc += fix_isqrt(i * 2654435761u);
+	timer_report(&t, "fix_isqrt", n);
+
+	sink = acc;
+}
+
+
+int
+main(void)
+{
+	sin_accuracy();
+	polar_accuracy();
+	isqrt_accuracy();
+	costs();
+
+	return failed;
+}
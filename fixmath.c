@@ -0,0 +1,444 @@
+/** \file
+ * Fixed point trigonometry and square roots.
+ */
+#include <stdint.h>
+#include "fixmath.h"
+#include "memspaces.h"
+
+/** CORDIC iterations; each adds about a bit to the angle */
+#define CORDIC_STEPS	16
+
+/** 1 / CORDIC gain, 0.607253, in Q15 as 19898 + 15/32 */
+#define CORDIC_GAIN	19898
+#define CORDIC_GAIN_FRAC	15 // 32nds
+
+
+/** A quarter wave of sin in Q14, 256 steps:
+perl -e 'printf "\t%.0f,\n", 16384 * sin($_ * atan2(1, 1) / 128) for 0..256'
+ * The extra last entry saves handling the end of the table.
+ */
+static const uint16_t PROGMEM fix_sin_table[] = {
+	0,
+	101,
+	201,
+	302,
+	402,
+	503,
+	603,
+	704,
+	804,
+	904,
+	1005,
+	1105,
+	1205,
+	1306,
+	1406,
+	1506,
+	1606,
+	1706,
+	1806,
+	1906,
+	2006,
+	2105,
+	2205,
+	2305,
+	2404,
+	2503,
+	2603,
+	2702,
+	2801,
+	2900,
+	2999,
+	3098,
+	3196,
+	3295,
+	3393,
+	3492,
+	3590,
+	3688,
+	3786,
+	3883,
+	3981,
+	4078,
+	4176,
+	4273,
+	4370,
+	4467,
+	4563,
+	4660,
+	4756,
+	4852,
+	4948,
+	5044,
+	5139,
+	5235,
+	5330,
+	5425,
+	5520,
+	5614,
+	5708,
+	5803,
+	5897,
+	5990,
+	6084,
+	6177,
+	6270,
+	6363,
+	6455,
+	6547,
+	6639,
+	6731,
+	6823,
+	6914,
+	7005,
+	7096,
+	7186,
+	7276,
+	7366,
+	7456,
+	7545,
+	7635,
+	7723,
+	7812,
+	7900,
+	7988,
+	8076,
+	8163,
+	8250,
+	8337,
+	8423,
+	8509,
+	8595,
+	8680,
+	8765,
+	8850,
+	8935,
+	9019,
+	9102,
+	9186,
+	9269,
+	9352,
+	9434,
+	9516,
+	9598,
+	9679,
+	9760,
+	9841,
+	9921,
+	10001,
+	10080,
+	10159,
+	10238,
+	10316,
+	10394,
+	10471,
+	10549,
+	10625,
+	10702,
+	10778,
+	10853,
+	10928,
+	11003,
+	11077,
+	11151,
+	11224,
+	11297,
+	11370,
+	11442,
+	11514,
+	11585,
+	11656,
+	11727,
+	11797,
+	11866,
+	11935,
+	12004,
+	12072,
+	12140,
+	12207,
+	12274,
+	12340,
+	12406,
+	12472,
+	12537,
+	12601,
+	12665,
+	12729,
+	12792,
+	12854,
+	12916,
+	12978,
+	13039,
+	13100,
+	13160,
+	13219,
+	13279,
+	13337,
+	13395,
+	13453,
+	13510,
+	13567,
+	13623,
+	13678,
+	13733,
+	13788,
+	13842,
+	13896,
+	13949,
+	14001,
+	14053,
+	14104,
+	14155,
+	14206,
+	14256,
+	14305,
+	14354,
+	14402,
+	14449,
+	14497,
+	14543,
+	14589,
+	14635,
+	14680,
+	14724,
+	14768,
+	14811,
+	14854,
+	14896,
+	14937,
+	14978,
+	15019,
+	15059,
+	15098,
+	15137,
+	15175,
+	15213,
+	15250,
+	15286,
+	15322,
+	15357,
+	15392,
+	15426,
+	15460,
+	15493,
+	15525,
+	15557,
+	15588,
+	15619,
+	15649,
+	15679,
+	15707,
+	15736,
+	15763,
+	15791,
+	15817,
+	15843,
+	15868,
+	15893,
+	15917,
+	15941,
+	15964,
+	15986,
+	16008,
+	16029,
+	16049,
+	16069,
+	16088,
+	16107,
+	16125,
+	16143,
+	16160,
+	16176,
+	16192,
+	16207,
+	16221,
+	16235,
+	16248,
+	16261,
+	16273,
+	16284,
+	16295,
+	16305,
+	16315,
+	16324,
+	16332,
+	16340,
+	16347,
+	16353,
+	16359,
+	16364,
+	16369,
+	16373,
+	16376,
+	16379,
+	16381,
+	16383,
+	16384,
+	16384,
+	16384 // duplicate to avoid extra code for handling last case
+};
+
+
+/** atan(2^-i) in 2^32 units to the turn:
+perl -e 'printf "\t%.0f,\n", 2**32 * atan2(2**-$_, 1) / (8 * atan2(1, 1)) for 0..15'
+ */
+static const uint32_t PROGMEM cordic_table[CORDIC_STEPS] = {
+	536870912,
+	316933406,
+	167458907,
+	85004756,
+	42667331,
+	21354465,
+	10679838,
+	5340245,
+	2670163,
+	1335087,
+	667544,
+	333772,
+	166886,
+	83443,
+	41722,
+	20861,
+};
+
+
+int16_t
+fix_sin(
+	uint16_t angle
+)
+{
+	// fold into the first quadrant, 0 to 0x4000 inclusive
+	uint16_t a = angle & 0x3FFF;
+	if (angle & 0x4000)
+		a = 0x4000 - a;
+
+	const uint16_t i = a >> 6;
+	const uint8_t frac = a & 0x3F;
+	const int16_t s0 = pgm_read_word(&fix_sin_table[i + 0]);
+	const int16_t s1 = pgm_read_word(&fix_sin_table[i + 1]);
+	const int16_t s = s0 + (((s1 - s0) * frac + 32) >> 6);
+
+	return angle & 0x8000 ? -s : s;
+}
+
+
+uint16_t
+fix_polar(
+	int16_t x0,
+	int16_t y0,
+	uint16_t * mag
+)
+{
+	if (x0 == 0 && y0 == 0)
+	{
+		if (mag)
+			*mag = 0;
+		return 0;
+	}
+
+	int32_t x = x0;
+	int32_t y = y0;
+	uint32_t angle = 0;
+
+	// CORDIC only converges within 90 degrees of +x
+	if (x < 0)
+	{
+		x = -x;
+		y = -y;
+		angle = 0x80000000;
+	}
+
+	// scale up so the shifts in the loop keep as many bits as
+	// possible; the gain of 1.65 still fits in 31 bits
+	const uint32_t ay = y < 0 ? -y : y;
+	uint32_t m = (uint32_t) x > ay ? (uint32_t) x : ay;
+	uint8_t shift = 0;
+	while (m < (1UL << 26))
+	{
+		m <<= 1;
+		shift++;
+	}
+	x <<= shift;
+	y <<= shift;
+
+	// rotate the vector onto the x axis, adding up the angles
+	for (uint8_t i = 0 ; i < CORDIC_STEPS ; i++)
+	{
+		const int32_t xs = x >> i;
+		const int32_t ys = y >> i;
+		const uint32_t step = pgm_read_dword(&cordic_table[i]);
+
+		if (y > 0)
+		{
+			x += ys;
+			y -= xs;
+			angle += step;
+		} else {
+			x -= ys;
+			y += xs;
+			angle -= step;
+		}
+	}
+
+	if (mag)
+	{
+		// inputs are at most 16 bits, so shift is at least 11;
+		// keep one extra bit for the rounding
+		const uint32_t x2 = ((uint32_t) x + (1UL << (shift - 2))) >> (shift - 1);
+		const uint32_t prod = x2 * CORDIC_GAIN
+			+ ((x2 * CORDIC_GAIN_FRAC) >> 5);
+		*mag = (prod + (1UL << 15)) >> 16;
+	}
+
+	return (angle + 0x8000) >> 16;
+}
+
+
+uint16_t
+fix_atan2(
+	int16_t y,
+	int16_t x
+)
+{
+	return fix_polar(x, y, 0);
+}
+
+
+uint16_t
+fix_hypot(
+	int16_t x,
+	int16_t y
+)
+{
+	uint16_t mag;
+	fix_polar(x, y, &mag);
+	return mag;
+}
+
+
+uint16_t
+fix_isqrt(
+	uint32_t x
+)
+{
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+
+	while (bit > x)
+		bit >>= 2;
+
+	// one bit of the root per pass
+	while (bit)
+	{
+		if (x >= root + bit)
+		{
+			x -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return root;
+}
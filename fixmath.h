@@ -0,0 +1,75 @@
+/** \file
+ * Fixed point trigonometry and square roots.
+ *
+ * Angles are 16-bit, with 65536 to a full turn, so they wrap around
+ * for free.  sin and cos are Q14, with 16384 == 1.0, from a quarter
+ * wave table of 1024 steps to the turn, linearly interpolated with
+ * the low six bits of the angle.  Unlike sin_lookup() these follow
+ * the usual convention: angle 0 is along +x and angles increase
+ * towards +y.
+ *
+ * atan2 and the magnitude of a vector come from the same CORDIC loop,
+ * which needs only shifts and adds.
+ */
+#ifndef _fixmath_h_
+#define _fixmath_h_
+
+#include <stdint.h>
+
+#define FIX_ONE		16384 // 1.0 in Q14
+#define FIX_SHIFT	14
+
+/** Angle units for a number of degrees, for constant expressions */
+#define FIX_DEGREES(d)	((uint16_t) ((int32_t) ((d) * 65536.0 / 360.0)))
+
+
+extern int16_t
+fix_sin(
+	uint16_t angle
+);
+
+
+static inline int16_t
+fix_cos(
+	uint16_t angle
+)
+{
+	return fix_sin(angle + 0x4000);
+}
+
+
+/** Angle of the vector (x,y), from 0 to 65535.
+ * atan2(0,0) is 0.
+ */
+extern uint16_t
+fix_atan2(
+	int16_t y,
+	int16_t x
+);
+
+
+/** Length of the vector (x,y), rounded to the nearest unit */
+extern uint16_t
+fix_hypot(
+	int16_t x,
+	int16_t y
+);
+
+
+/** Angle and length of a vector at once, for the cost of either */
+extern uint16_t
+fix_polar(
+	int16_t x,
+	int16_t y,
+	uint16_t * mag
+);
+
+
+/** Integer square root, rounded down */
+extern uint16_t
+fix_isqrt(
+	uint32_t x
+);
+
+
+#endif
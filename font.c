@@ -0,0 +1,226 @@
+/** \file
+ * Vector font registry and glyph decoder.
+ *
+ * The Hershey fonts are stored delta-coded in program memory by
+ * "./fontgen compress" and are decoded one glyph at a time on demand.
+ */
+#include <stdint.h>
+#include <string.h>
+#include "memspaces.h"
+#include "hershey.h"
+#include "asteroids-font.h"
+#include "font.h"
+
+
+HERSHEY_FONT_DECLARE(simplex);
+HERSHEY_FONT_DECLARE(script);
+
+/** Indexed by font_t - FONT_HERSHEY_SIMPLEX */
+static const hershey_font_t * const PROGMEM hershey_fonts[] = {
+	&hershey_simplex_font,
+	&hershey_script_font,
+};
+
+
+typedef struct
+{
+	uint8_t font;
+	uint8_t c; // 0 if the slot is empty
+	uint8_t lod;
+	glyph_t g;
+} font_cache_t;
+
+/** The last glyph decoded */
+static font_cache_t font_cache;
+
+
+static inline void
+glyph_point(
+	glyph_t * const g,
+	const int8_t x,
+	const int8_t y,
+	const uint8_t pen_up
+)
+{
+	const uint8_t n = g->count++;
+	if (pen_up)
+		g->pen_up[n >> 3] |= 1 << (n & 7);
+	g->x[n] = x;
+	g->y[n] = y;
+}
+
+
+static void
+hershey_decode(
+	glyph_t * const g,
+	const font_t font,
+	const uint8_t c,
+	const uint8_t lod
+)
+{
+	const hershey_font_t * const f
+		= pgm_read_ptr(&hershey_fonts[font - FONT_HERSHEY_SIMPLEX]);
+	const uint8_t * const data = pgm_read_ptr(&f->data);
+	const uint16_t * const offset = pgm_read_ptr(&f->offset);
+	const uint8_t * p = data + pgm_read_word(&offset[c - 0x20]);
+
+	// At the small scales many points collapse onto each other;
+	// only keep the ones that survive the level-of-detail pass.
+	const uint8_t * mask = NULL;
+	if (lod < HERSHEY_LOD_SCALES)
+	{
+		const uint8_t * const masks = pgm_read_ptr(&f->lod);
+		const uint8_t lod_bytes = pgm_read_byte(&f->lod_bytes);
+		mask = masks + ((c - 0x20) * HERSHEY_LOD_SCALES + lod) * (uint16_t) lod_bytes;
+	}
+
+	int8_t x = 0;
+	int8_t y = 0;
+	uint8_t pen_up = 1;
+	uint8_t keep = 0;
+	uint8_t entry = 0;
+
+	g->width = pgm_read_byte(p++);
+
+	while (1)
+	{
+		const uint8_t b = pgm_read_byte(p++);
+		if (b == HERSHEY_END)
+			break;
+
+		uint8_t draw = 1;
+		if (mask)
+		{
+			if ((entry++ & 7) == 0)
+				keep = pgm_read_byte(mask++);
+			draw = keep & 1;
+			keep >>= 1;
+		}
+
+		if (b == HERSHEY_PEN_UP)
+		{
+			if (draw)
+				pen_up = 1;
+			continue;
+		}
+
+		if (b == HERSHEY_ABS)
+		{
+			x = pgm_read_byte(p++);
+			y = pgm_read_byte(p++);
+		} else {
+			x += (int8_t) b >> 4;
+			y += (int8_t) (b << 4) >> 4;
+		}
+
+		if (!draw)
+			continue;
+
+		glyph_point(g, x, y, pen_up);
+		pen_up = 0;
+	}
+}
+
+
+static void
+asteroids_decode(
+	glyph_t * const g,
+	uint8_t c
+)
+{
+	uint8_t pen_up = 1;
+
+	if ('a' <= c && c <= 'z')
+		c += 'A' - 'a';
+
+	const asteroids_char_t * const p = &asteroids_font[c - 0x20];
+	for (uint8_t i = 0 ; i < 8 ; i++)
+	{
+		const uint8_t xy = pgm_read_byte(&p->points[i]);
+		if (xy == 0xFF)
+			break;
+		if (xy == 0xFE)
+		{
+			pen_up = 1;
+			continue;
+		}
+
+		glyph_point(g, ((xy >> 4) & 0xF) * 2, ((xy >> 0) & 0xF) * 2, pen_up);
+		pen_up = 0;
+	}
+
+	g->width = 20;
+}
+
+
+uint8_t
+font_bbox(
+	const font_t font,
+	uint8_t c,
+	glyph_bbox_t * const bbox
+)
+{
+	const glyph_bbox_t * p;
+	uint8_t width;
+
+	if (c < 0x20 || c > 0x7E)
+		return 0;
+
+	if (font == FONT_ASTEROIDS)
+	{
+		if ('a' <= c && c <= 'z')
+			c += 'A' - 'a';
+		p = &asteroids_font_bbox[c - 0x20];
+		width = 20;
+	} else {
+		const hershey_font_t * const f
+			= pgm_read_ptr(&hershey_fonts[font - FONT_HERSHEY_SIMPLEX]);
+		const uint8_t * const data = pgm_read_ptr(&f->data);
+		const uint16_t * const offset = pgm_read_ptr(&f->offset);
+		const glyph_bbox_t * const boxes = pgm_read_ptr(&f->bbox);
+
+		p = &boxes[c - 0x20];
+		width = pgm_read_byte(&data[pgm_read_word(&offset[c - 0x20])]);
+	}
+
+	bbox->x0 = pgm_read_byte(&p->x0);
+	bbox->y0 = pgm_read_byte(&p->y0);
+	bbox->x1 = pgm_read_byte(&p->x1);
+	bbox->y1 = pgm_read_byte(&p->y1);
+
+	return width;
+}
+
+
+const glyph_t *
+font_glyph(
+	const font_t font,
+	const uint8_t c,
+	uint8_t lod
+)
+{
+	if (c < 0x20 || c > 0x7E)
+		return NULL;
+
+	if (font == FONT_ASTEROIDS || lod > HERSHEY_LOD_SCALES)
+		lod = HERSHEY_LOD_SCALES;
+
+	glyph_t * const g = &font_cache.g;
+	if (font_cache.c == c
+	&&  font_cache.font == font
+	&&  font_cache.lod == lod)
+		return g;
+
+	font_cache.font = font;
+	font_cache.c = c;
+	font_cache.lod = lod;
+	memset(g->pen_up, 0, sizeof(g->pen_up));
+	g->count = 0;
+
+	if (font == FONT_ASTEROIDS)
+		asteroids_decode(g, c);
+	else
+		hershey_decode(g, font, c, lod);
+
+	return g;
+}
@@ -0,0 +1,95 @@
+/** \file
+ * Vector font registry and glyph decoder.
+ */
+#ifndef _font_h_
+#define _font_h_
+
+#include <stdint.h>
+
+
+/** Fonts that can be drawn by the glyph pipeline.
+ *
+ * Other Hershey fonts can be generated with "./fontgen compress" and
+ * added after script here and in hershey_fonts[] in font.c.
+ */
+typedef enum
+{
+	FONT_ASTEROIDS,
+	FONT_HERSHEY_SIMPLEX,
+	FONT_HERSHEY_SCRIPT,
+} font_t;
+
+
+/** Largest glyph in any font; script '@' and 'M' have 42 points.
+ * fontgen refuses to compress a font with a larger glyph.
+ */
+#define GLYPH_MAX_POINTS 42
+
+
+/** A glyph decoded from program memory, ready to be transformed.
+ * Pen-up markers are removed; instead bit i of pen_up is set
+ * if point i starts a new stroke.
+ */
+typedef struct
+{
+	uint8_t count;
+	uint8_t width;
+	uint8_t pen_up[(GLYPH_MAX_POINTS + 7) / 8];
+	int8_t x[GLYPH_MAX_POINTS];
+	int8_t y[GLYPH_MAX_POINTS];
+} glyph_t;
+
+
+static inline uint8_t
+glyph_pen_up(
+	const glyph_t * const g,
+	const uint8_t i
+)
+{
+	return (g->pen_up[i >> 3] >> (i & 7)) & 1;
+}
+
+
+/** Extents of a glyph in font units, inclusive.
+ * Glyphs that draw nothing, like space, have x1 < x0.
+ */
+typedef struct
+{
+	int8_t x0;
+	int8_t y0;
+	int8_t x1;
+	int8_t y1;
+} glyph_bbox_t;
+
+
+/** Look up the bounding box of character c without decoding it.
+ *
+ * The boxes are generated by fontgen and cover every point of the
+ * glyph, so they also bound the level-of-detail versions.
+ * Returns the advance width, or 0 if the character is not printable.
+ */
+uint8_t
+font_bbox(
+	font_t font,
+	uint8_t c,
+	glyph_bbox_t * bbox
+);
+
+
+/** Decode character c of a font.
+ *
+ * lod selects the Hershey level-of-detail mask; pass
+ * HERSHEY_LOD_SCALES or higher to draw every point.
+ * The glyph is kept in a single slot cache, so it is only good until
+ * the next call; drawing the same character again, as the rotating
+ * and repeated text does every frame, does not decode it again.
+ * Returns NULL if the character is not printable.
+ */
+const glyph_t *
+font_glyph(
+	font_t font,
+	uint8_t c,
+	uint8_t lod
+);
+
+#endif
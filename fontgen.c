@@ -0,0 +1,1148 @@
+/** \file
+ * Host tool to generate the vector font tables.
+ *
+ * Build and run on the host, not the AVR:
+ *
+ *	make fontgen
+ *	./fontgen optimize > hershey.new && mv hershey.new hershey.c
+ *	./fontgen compress simplex > hershey-simplex.c
+ *	./fontgen compress script scripts.jhf > hershey-script.c
+ *	./fontgen bbox > asteroids-bbox.c
+ *
+ * "optimize" rewrites every hershey_simplex glyph so that the beam
+ * spends as little time as possible travelling with the pen up.
+ * Duplicate and collinear points are dropped from each stroke, strokes
+ * that draw nothing are removed, closed loops are rotated to the best
+ * starting vertex and the strokes are reordered and reversed to
+ * minimize the pen-up distance inside the glyph.  The cost is the
+ * same |dx|+|dy| that moveto() waits for on slow scopes.
+ *
+ * "compress" optimizes a font the same way and writes it in the
+ * delta-coded format that font.c decodes, along with the
+ * level-of-detail masks for the small text sizes.  Each stroke is
+ * simplified with Douglas-Peucker at a tolerance of one DAC step after
+ * scaling, and the surviving points are recorded as a bitmask per
+ * glyph so that the decoder can skip the others.  Without a file it
+ * compresses the built-in hershey_simplex table, otherwise it imports
+ * a font in the standard .jhf Hershey format.  The output also has
+ * the bounding box of every glyph for text layout and culling.
+ *
+ * "bbox" writes the bounding boxes for the asteroids font, in the
+ * doubled units that font.c decodes it to.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "hershey.h"
+#include "asteroids-font.h"
+#include "font.h"
+
+#define GLYPH_COUNT	(0x7F - 0x20)
+#define MAX_ENTRIES	256
+#define MAX_STROKES	64
+
+/** Held-Karp is exact but exponential; use it up to this many strokes */
+#define MAX_EXACT_STROKES 8
+
+/** The .jhf glyphs have the baseline at y=9 and y increasing down */
+#define JHF_BASELINE	9
+
+
+typedef struct
+{
+	int x;
+	int y;
+} pt_t;
+
+typedef struct
+{
+	unsigned n;
+	int closed;
+	pt_t p[MAX_ENTRIES];
+} stroke_t;
+
+typedef struct
+{
+	unsigned width;
+	unsigned count;
+	stroke_t s[MAX_STROKES];
+} outline_t;
+
+/** A glyph as a flat list of points and pen-up markers, in the
+ * order that they are stored in the font tables.
+ */
+typedef struct
+{
+	unsigned width;
+	unsigned count;
+	int up[MAX_ENTRIES];
+	pt_t p[MAX_ENTRIES];
+} flat_t;
+
+
+static int
+pt_eq(
+	pt_t a,
+	pt_t b
+)
+{
+	return a.x == b.x && a.y == b.y;
+}
+
+
+static unsigned
+travel(
+	pt_t a,
+	pt_t b
+)
+{
+	return abs(a.x - b.x) + abs(a.y - b.y);
+}
+
+
+/** Split a flat glyph into its pen-down strokes */
+static void
+glyph_read(
+	outline_t * const g,
+	const flat_t * const f
+)
+{
+	stroke_t * s = NULL;
+
+	memset(g, 0, sizeof(*g));
+	g->width = f->width;
+
+	for (unsigned i = 0 ; i < f->count ; i++)
+	{
+		if (f->up[i])
+		{
+			s = NULL;
+			continue;
+		}
+
+		if (!s)
+		{
+			if (g->count == MAX_STROKES)
+			{
+				fprintf(stderr, "too many strokes\n");
+				exit(EXIT_FAILURE);
+			}
+			s = &g->s[g->count++];
+		}
+
+		s->p[s->n++] = f->p[i];
+	}
+}
+
+
+static void
+glyph_flatten(
+	flat_t * const f,
+	const outline_t * const g
+)
+{
+	f->width = g->width;
+	f->count = 0;
+
+	for (unsigned i = 0 ; i < g->count ; i++)
+	{
+		if (i != 0)
+			f->up[f->count++] = 1;
+
+		for (unsigned j = 0 ; j < g->s[i].n ; j++)
+		{
+			f->up[f->count] = 0;
+			f->p[f->count++] = g->s[i].p[j];
+		}
+	}
+}
+
+
+/** Convert a glyph from the hershey_char_t source table */
+static void
+flat_from_table(
+	flat_t * const f,
+	const hershey_char_t * const h
+)
+{
+	f->width = h->width;
+	f->count = h->count;
+
+	for (unsigned i = 0 ; i < h->count ; i++)
+	{
+		const int x = h->points[2*i+0];
+		const int y = h->points[2*i+1];
+		f->up[i] = x == -1 && y == -1;
+		f->p[i] = (pt_t) { x, y };
+	}
+}
+
+
+/** Remove duplicate points and intermediate points that lie on a
+ * straight run.  A point where the stroke doubles back on itself is
+ * kept, since dropping it would shorten the drawn line.
+ */
+static void
+stroke_simplify(
+	stroke_t * const s
+)
+{
+	unsigned n = 0;
+
+	for (unsigned i = 0 ; i < s->n ; i++)
+	{
+		const pt_t c = s->p[i];
+		if (n > 0 && pt_eq(s->p[n-1], c))
+			continue;
+
+		if (n > 1)
+		{
+			const pt_t a = s->p[n-2];
+			const pt_t b = s->p[n-1];
+			const int cross = (b.x - a.x) * (c.y - b.y)
+				- (b.y - a.y) * (c.x - b.x);
+			const int dot = (b.x - a.x) * (c.x - b.x)
+				+ (b.y - a.y) * (c.y - b.y);
+			if (cross == 0 && dot > 0)
+				n--;
+		}
+
+		s->p[n++] = c;
+	}
+
+	s->n = n;
+	s->closed = n > 2 && pt_eq(s->p[0], s->p[n-1]);
+
+	// The closing vertex of a loop may also be on a straight run
+	if (s->closed && s->n > 3)
+	{
+		const pt_t a = s->p[n-2];
+		const pt_t b = s->p[0];
+		const pt_t c = s->p[1];
+		const int cross = (b.x - a.x) * (c.y - b.y)
+			- (b.y - a.y) * (c.x - b.x);
+		const int dot = (b.x - a.x) * (c.x - b.x)
+			+ (b.y - a.y) * (c.y - b.y);
+		if (cross == 0 && dot > 0)
+		{
+			memmove(&s->p[0], &s->p[1], (n - 2) * sizeof(s->p[0]));
+			s->p[n-2] = s->p[0];
+			s->n = n - 1;
+		}
+	}
+}
+
+
+/** Each stroke can be drawn in several ways: open strokes forwards
+ * or backwards, closed loops starting from any of their vertices.
+ */
+static unsigned
+stroke_variants(
+	const stroke_t * const s
+)
+{
+	return s->closed ? s->n - 1 : 2;
+}
+
+
+static pt_t
+stroke_start(
+	const stroke_t * const s,
+	unsigned v
+)
+{
+	if (s->closed)
+		return s->p[v];
+	return v ? s->p[s->n - 1] : s->p[0];
+}
+
+
+static pt_t
+stroke_end(
+	const stroke_t * const s,
+	unsigned v
+)
+{
+	// Loops finish where they started
+	if (s->closed)
+		return s->p[v];
+	return v ? s->p[0] : s->p[s->n - 1];
+}
+
+
+static void
+stroke_apply(
+	stroke_t * const dst,
+	const stroke_t * const s,
+	unsigned v
+)
+{
+	*dst = *s;
+
+	if (s->closed)
+	{
+		for (unsigned i = 0 ; i < s->n ; i++)
+			dst->p[i] = s->p[(v + i) % (s->n - 1)];
+		return;
+	}
+
+	if (v)
+		for (unsigned i = 0 ; i < s->n ; i++)
+			dst->p[i] = s->p[s->n - 1 - i];
+}
+
+
+static unsigned
+glyph_travel(
+	const outline_t * const g
+)
+{
+	unsigned cost = 0;
+	for (unsigned i = 1 ; i < g->count ; i++)
+		cost += travel(g->s[i-1].p[g->s[i-1].n - 1], g->s[i].p[0]);
+	return cost;
+}
+
+
+/** Find the exact minimum pen-up travel order with a Held-Karp
+ * search over the subsets of strokes.  Returns the stroke and
+ * variant order in order[] and the cost.
+ */
+static unsigned
+order_exact(
+	const outline_t * const g,
+	unsigned order[][2]
+)
+{
+	const unsigned n = g->count;
+	const unsigned states = 1u << n;
+
+	unsigned nv = 0;
+	for (unsigned i = 0 ; i < n ; i++)
+		if (stroke_variants(&g->s[i]) > nv)
+			nv = stroke_variants(&g->s[i]);
+
+#define IDX(m,i,v) (((m) * n + (i)) * nv + (v))
+	unsigned * const cost = malloc(states * n * nv * sizeof(*cost));
+	uint16_t * const prev = malloc(states * n * nv * sizeof(*prev) * 2);
+
+	for (unsigned k = 0 ; k < states * n * nv ; k++)
+		cost[k] = ~0u;
+
+	for (unsigned i = 0 ; i < n ; i++)
+		for (unsigned v = 0 ; v < stroke_variants(&g->s[i]) ; v++)
+			cost[IDX(1u << i, i, v)] = 0;
+
+	for (unsigned m = 1 ; m < states ; m++)
+	{
+		for (unsigned i = 0 ; i < n ; i++)
+		{
+			if ((m & (1u << i)) == 0)
+				continue;
+
+			for (unsigned v = 0 ; v < stroke_variants(&g->s[i]) ; v++)
+			{
+				const unsigned c = cost[IDX(m,i,v)];
+				if (c == ~0u)
+					continue;
+				const pt_t end = stroke_end(&g->s[i], v);
+
+				for (unsigned j = 0 ; j < n ; j++)
+				{
+					if (m & (1u << j))
+						continue;
+					const unsigned m2 = m | (1u << j);
+
+					for (unsigned w = 0 ; w < stroke_variants(&g->s[j]) ; w++)
+					{
+						const unsigned c2 = c + travel(end, stroke_start(&g->s[j], w));
+						if (c2 >= cost[IDX(m2,j,w)])
+							continue;
+						cost[IDX(m2,j,w)] = c2;
+						prev[2*IDX(m2,j,w)+0] = i;
+						prev[2*IDX(m2,j,w)+1] = v;
+					}
+				}
+			}
+		}
+	}
+
+	unsigned best = ~0u;
+	unsigned bi = 0;
+	unsigned bv = 0;
+	for (unsigned i = 0 ; i < n ; i++)
+	{
+		for (unsigned v = 0 ; v < stroke_variants(&g->s[i]) ; v++)
+		{
+			if (cost[IDX(states-1,i,v)] >= best)
+				continue;
+			best = cost[IDX(states-1,i,v)];
+			bi = i;
+			bv = v;
+		}
+	}
+
+	unsigned m = states - 1;
+	for (unsigned k = n ; k-- > 0 ; )
+	{
+		order[k][0] = bi;
+		order[k][1] = bv;
+		const unsigned pi = prev[2*IDX(m,bi,bv)+0];
+		const unsigned pv = prev[2*IDX(m,bi,bv)+1];
+		m &= ~(1u << bi);
+		bi = pi;
+		bv = pv;
+	}
+#undef IDX
+
+	free(cost);
+	free(prev);
+	return best;
+}
+
+
+/** Nearest-neighbour ordering for glyphs with too many strokes for
+ * the exact search, trying every possible first stroke.
+ */
+static unsigned
+order_greedy(
+	const outline_t * const g,
+	unsigned order[][2]
+)
+{
+	const unsigned n = g->count;
+	unsigned best = ~0u;
+
+	for (unsigned first = 0 ; first < n ; first++)
+	{
+		for (unsigned fv = 0 ; fv < stroke_variants(&g->s[first]) ; fv++)
+		{
+			unsigned trial[MAX_STROKES][2];
+			int used[MAX_STROKES] = { 0 };
+			unsigned cost = 0;
+
+			trial[0][0] = first;
+			trial[0][1] = fv;
+			used[first] = 1;
+
+			for (unsigned k = 1 ; k < n ; k++)
+			{
+				const pt_t end = stroke_end(&g->s[trial[k-1][0]], trial[k-1][1]);
+				unsigned bc = ~0u;
+
+				for (unsigned j = 0 ; j < n ; j++)
+				{
+					if (used[j])
+						continue;
+					for (unsigned w = 0 ; w < stroke_variants(&g->s[j]) ; w++)
+					{
+						const unsigned c = travel(end, stroke_start(&g->s[j], w));
+						if (c >= bc)
+							continue;
+						bc = c;
+						trial[k][0] = j;
+						trial[k][1] = w;
+					}
+				}
+
+				used[trial[k][0]] = 1;
+				cost += bc;
+			}
+
+			if (cost >= best)
+				continue;
+			best = cost;
+			memcpy(order, trial, n * sizeof(trial[0]));
+		}
+	}
+
+	return best;
+}
+
+
+static void
+glyph_reorder(
+	outline_t * const g
+)
+{
+	const unsigned n = g->count;
+	if (n < 2)
+		return;
+
+	unsigned order[MAX_STROKES][2];
+	const unsigned best = n <= MAX_EXACT_STROKES
+		? order_exact(g, order)
+		: order_greedy(g, order);
+
+	// Only rewrite the glyph if it is a strict improvement so that
+	// the regenerated table is stable.
+	if (best >= glyph_travel(g))
+		return;
+
+	outline_t * const out = malloc(sizeof(*out));
+	*out = *g;
+	for (unsigned k = 0 ; k < n ; k++)
+		stroke_apply(&out->s[k], &g->s[order[k][0]], order[k][1]);
+
+	*g = *out;
+	free(out);
+}
+
+
+static void
+glyph_optimize(
+	outline_t * const g
+)
+{
+	unsigned n = 0;
+
+	for (unsigned i = 0 ; i < g->count ; i++)
+	{
+		stroke_simplify(&g->s[i]);
+
+		// a single point is never drawn by the renderer
+		if (g->s[i].n < 2)
+			continue;
+		g->s[n++] = g->s[i];
+	}
+
+	g->count = n;
+	glyph_reorder(g);
+}
+
+
+/** Optimize a whole font in place, returning the pen-up travel */
+static void
+font_optimize(
+	flat_t * const font,
+	unsigned * const before,
+	unsigned * const after
+)
+{
+	outline_t * const g = malloc(sizeof(*g));
+
+	*before = *after = 0;
+
+	for (unsigned c = 0 ; c < GLYPH_COUNT ; c++)
+	{
+		glyph_read(g, &font[c]);
+		*before += glyph_travel(g);
+		glyph_optimize(g);
+		*after += glyph_travel(g);
+		glyph_flatten(&font[c], g);
+	}
+
+	free(g);
+}
+
+
+/** Output a glyph in the same layout as hershey.c */
+static void
+glyph_print(
+	const flat_t * const f,
+	unsigned c
+)
+{
+	unsigned col = 0;
+
+	printf("\t{\n\t\t%2u,%2u, /* Ascii %u */\n",
+		f->count,
+		f->width,
+		c
+	);
+
+	if (f->count == 0)
+	{
+		printf("\t},\n");
+		return;
+	}
+
+	printf("\t\t{");
+	for (unsigned i = 0 ; i < f->count ; i++)
+	{
+		if (col == 10)
+		{
+			printf("\n\t\t ");
+			col = 0;
+		}
+
+		if (f->up[i])
+			printf(" -1,-1,");
+		else
+			printf(" %2d,%2d,", f->p[i].x, f->p[i].y);
+		col++;
+	}
+	printf(" },\n\t},\n");
+}
+
+
+static void
+font_builtin(
+	flat_t * const font
+)
+{
+	for (unsigned c = 0 ; c < GLYPH_COUNT ; c++)
+		flat_from_table(&font[c], &hershey_simplex[c]);
+}
+
+
+/** Read the next vertex character, skipping line breaks */
+static int
+jhf_getc(
+	FILE * const f
+)
+{
+	while (1)
+	{
+		const int ch = fgetc(f);
+		if (ch != '\n' && ch != '\r')
+			return ch;
+	}
+}
+
+
+/** Import a font in the .jhf format.
+ *
+ * Each glyph is a 5 digit glyph number, a 3 digit vertex count and
+ * then pairs of characters with coordinates relative to 'R'.  The
+ * first pair is the left and right margin and " R" is a pen-up.
+ * Long glyphs continue on the following lines.  The glyphs for
+ * ASCII 32 to 126 are in order.
+ */
+static void
+font_jhf(
+	flat_t * const font,
+	const char * const filename
+)
+{
+	FILE * const f = fopen(filename, "r");
+	if (!f)
+	{
+		perror(filename);
+		exit(EXIT_FAILURE);
+	}
+
+	for (unsigned c = 0 ; c < GLYPH_COUNT ; c++)
+	{
+		char hdr[9];
+		flat_t * const g = &font[c];
+
+		const int first = jhf_getc(f);
+		if (first == EOF)
+		{
+			fprintf(stderr, "%s: only %u glyphs\n", filename, c);
+			exit(EXIT_FAILURE);
+		}
+
+		hdr[0] = first;
+		for (unsigned i = 1 ; i < 8 ; i++)
+			hdr[i] = fgetc(f);
+		hdr[8] = '\0';
+
+		const unsigned count = atoi(&hdr[5]);
+		if (count == 0 || count > MAX_ENTRIES)
+		{
+			fprintf(stderr, "%s: bad glyph header '%s'\n", filename, hdr);
+			exit(EXIT_FAILURE);
+		}
+
+		const int left = jhf_getc(f) - 'R';
+		const int right = jhf_getc(f) - 'R';
+		g->width = right - left;
+		g->count = count - 1;
+
+		for (unsigned i = 0 ; i < g->count ; i++)
+		{
+			const int cx = jhf_getc(f);
+			const int cy = jhf_getc(f);
+			if (cx == EOF || cy == EOF)
+			{
+				fprintf(stderr, "%s: truncated\n", filename);
+				exit(EXIT_FAILURE);
+			}
+
+			g->up[i] = cx == ' ' && cy == 'R';
+			g->p[i] = (pt_t) {
+				cx - 'R' - left,
+				JHF_BASELINE - (cy - 'R'),
+			};
+		}
+	}
+
+	fclose(f);
+}
+
+
+static int
+optimize(void)
+{
+	flat_t * const font = calloc(GLYPH_COUNT, sizeof(*font));
+	unsigned before;
+	unsigned after;
+
+	font_builtin(font);
+	font_optimize(font, &before, &after);
+
+	printf(
+"/** \\file\n"
+" * Complete ASCII Hershey Simplex font.\n"
+" *\n"
+" * http://paulbourke.net/dataformats/hershey/\n"
+" *\n"
+" * A few characters are simplified.\n"
+" *\n"
+" * Generated by \"./fontgen optimize\": the stroke order and direction\n"
+" * of each glyph minimizes the pen-up travel.  Do not edit by hand;\n"
+" * edit the source glyphs and rerun the tool.\n"
+" *\n"
+" * This is the source table for fontgen; the firmware links the\n"
+" * compressed version in hershey-simplex.c.\n"
+" */\n"
+"#include <stdint.h>\n"
+"#include \"memspaces.h\"\n"
+"#include \"hershey.h\"\n"
+"\n"
+"const PROGMEM hershey_char_t hershey_simplex[] = {\n"
+	);
+
+	for (unsigned c = 0 ; c < GLYPH_COUNT ; c++)
+		glyph_print(&font[c], c + 0x20);
+
+	printf("};\n");
+
+	fprintf(stderr, "pen-up travel %u -> %u\n", before, after);
+	free(font);
+	return 0;
+}
+
+
+/** The factors used by scaling() in vector.c for the LOD scales */
+static const double lod_scale[HERSHEY_LOD_SCALES] = {
+	1.0 / 4,
+	2.0 / 3,
+};
+
+
+/** Distance from point p to the segment a-b */
+static double
+segment_dist(
+	double px,
+	double py,
+	double ax,
+	double ay,
+	double bx,
+	double by
+)
+{
+	const double dx = bx - ax;
+	const double dy = by - ay;
+	const double len2 = dx * dx + dy * dy;
+	double t = len2 == 0 ? 0 : ((px - ax) * dx + (py - ay) * dy) / len2;
+	if (t < 0)
+		t = 0;
+	if (t > 1)
+		t = 1;
+
+	return hypot(px - (ax + t * dx), py - (ay + t * dy));
+}
+
+
+/** Mark the points of f->p[lo..hi] that Douglas-Peucker keeps */
+static void
+douglas_peucker(
+	const flat_t * const f,
+	double scale,
+	unsigned lo,
+	unsigned hi,
+	int * const keep
+)
+{
+	if (hi <= lo + 1)
+		return;
+
+	const double ax = f->p[lo].x * scale;
+	const double ay = f->p[lo].y * scale;
+	const double bx = f->p[hi].x * scale;
+	const double by = f->p[hi].y * scale;
+
+	double worst = 0;
+	unsigned worst_i = lo;
+
+	for (unsigned i = lo + 1 ; i < hi ; i++)
+	{
+		const double d = segment_dist(
+			f->p[i].x * scale,
+			f->p[i].y * scale,
+			ax, ay, bx, by
+		);
+		if (d <= worst)
+			continue;
+		worst = d;
+		worst_i = i;
+	}
+
+	// Within one DAC step of the chord; the beam will not notice
+	if (worst <= 1.0)
+		return;
+
+	keep[worst_i] = 1;
+	douglas_peucker(f, scale, lo, worst_i, keep);
+	douglas_peucker(f, scale, worst_i, hi, keep);
+}
+
+
+/** Compute the LOD mask for a glyph, one bit per entry.
+ * mask must have room for every entry of the glyph.
+ */
+static void
+glyph_lod(
+	const flat_t * const f,
+	double scale,
+	uint8_t * const mask,
+	unsigned * const drawn
+)
+{
+	int keep[MAX_ENTRIES] = { 0 };
+	unsigned start = 0;
+
+	for (unsigned i = 0 ; i <= f->count ; i++)
+	{
+		if (i < f->count && !f->up[i])
+			continue;
+
+		// i is a pen-up or the end of the glyph; keep the stroke ends
+		if (i < f->count)
+			keep[i] = 1;
+		if (i > start)
+		{
+			keep[start] = 1;
+			keep[i - 1] = 1;
+			douglas_peucker(f, scale, start, i - 1, keep);
+		}
+
+		start = i + 1;
+	}
+
+	memset(mask, 0, (f->count + 7) / 8);
+	for (unsigned i = 0 ; i < f->count ; i++)
+	{
+		if (keep[i])
+			mask[i / 8] |= 1 << (i % 8);
+		if (keep[i] && !f->up[i])
+			(*drawn)++;
+	}
+}
+
+
+/** Delta-code a glyph in the format decoded by font.c */
+static unsigned
+glyph_encode(
+	const flat_t * const f,
+	uint8_t * const out
+)
+{
+	unsigned n = 0;
+	int x = 0;
+	int y = 0;
+
+	out[n++] = f->width;
+
+	for (unsigned i = 0 ; i < f->count ; i++)
+	{
+		if (f->up[i])
+		{
+			out[n++] = HERSHEY_PEN_UP;
+			continue;
+		}
+
+		const int dx = f->p[i].x - x;
+		const int dy = f->p[i].y - y;
+		x = f->p[i].x;
+		y = f->p[i].y;
+
+		// dx == -8 is reserved for the escape codes
+		if (-7 <= dx && dx <= 7 && -8 <= dy && dy <= 7)
+		{
+			out[n++] = ((dx & 0xF) << 4) | (dy & 0xF);
+			continue;
+		}
+
+		out[n++] = HERSHEY_ABS;
+		out[n++] = x & 0xFF;
+		out[n++] = y & 0xFF;
+	}
+
+	out[n++] = HERSHEY_END;
+	return n;
+}
+
+
+static glyph_bbox_t
+flat_bbox(
+	const flat_t * const f
+)
+{
+	glyph_bbox_t b = { 127, 127, -128, -128 };
+	unsigned n = 0;
+
+	for (unsigned i = 0 ; i < f->count ; i++)
+	{
+		if (f->up[i])
+			continue;
+		n++;
+		if (f->p[i].x < b.x0) b.x0 = f->p[i].x;
+		if (f->p[i].y < b.y0) b.y0 = f->p[i].y;
+		if (f->p[i].x > b.x1) b.x1 = f->p[i].x;
+		if (f->p[i].y > b.y1) b.y1 = f->p[i].y;
+	}
+
+	// Empty glyphs are marked with an inverted box
+	if (n == 0)
+		return (glyph_bbox_t) { 0, 0, -1, -1 };
+
+	return b;
+}
+
+
+static void
+bbox_print(
+	const char * const name,
+	const flat_t * const font
+)
+{
+	printf("const PROGMEM glyph_bbox_t %s_bbox[] = {\n", name);
+	for (unsigned c = 0 ; c < GLYPH_COUNT ; c++)
+	{
+		const glyph_bbox_t b = flat_bbox(&font[c]);
+		printf("\t{ %3d, %3d, %3d, %3d, }, /* Ascii %u */\n",
+			b.x0,
+			b.y0,
+			b.x1,
+			b.y1,
+			c + 0x20
+		);
+	}
+	printf("};\n");
+}
+
+
+static int
+compress(
+	const char * const name,
+	const char * const filename
+)
+{
+	flat_t * const font = calloc(GLYPH_COUNT, sizeof(*font));
+	unsigned before;
+	unsigned after;
+	unsigned offset[GLYPH_COUNT];
+	unsigned total = 0;
+	unsigned points = 0;
+	unsigned entries = 0;
+	unsigned drawn[HERSHEY_LOD_SCALES] = { 0 };
+
+	if (filename)
+		font_jhf(font, filename);
+	else
+		font_builtin(font);
+
+	font_optimize(font, &before, &after);
+
+	// The decoder has no room for the rest of a larger glyph
+	for (unsigned c = 0 ; c < GLYPH_COUNT ; c++)
+	{
+		const flat_t * const f = &font[c];
+		unsigned n = 0;
+		for (unsigned i = 0 ; i < f->count ; i++)
+			n += !f->up[i];
+
+		if (n > GLYPH_MAX_POINTS)
+		{
+			fprintf(stderr, "%s: Ascii %u has %u points, GLYPH_MAX_POINTS is %u\n",
+				name,
+				c + 0x20,
+				n,
+				GLYPH_MAX_POINTS
+			);
+			exit(EXIT_FAILURE);
+		}
+
+		points += n;
+		if (f->count > entries)
+			entries = f->count;
+	}
+
+	// Every glyph has a mask long enough for the largest one
+	const unsigned lod_bytes = (entries + 7) / 8;
+
+	printf(
+"/** \\file\n"
+" * Compressed Hershey %s font.\n"
+" *\n"
+" * Generated by \"./fontgen compress %s%s%s\"; do not edit by hand.\n"
+" */\n"
+"#include <stdint.h>\n"
+"#include \"memspaces.h\"\n"
+"#include \"hershey.h\"\n"
+"\n"
+"const PROGMEM uint8_t hershey_%s_data[] = {\n",
+		name,
+		name,
+		filename ? " " : "",
+		filename ? filename : "",
+		name
+	);
+
+	for (unsigned c = 0 ; c < GLYPH_COUNT ; c++)
+	{
+		uint8_t buf[3 * MAX_ENTRIES + 2];
+		const unsigned len = glyph_encode(&font[c], buf);
+
+		offset[c] = total;
+		total += len;
+
+		printf("\t/* Ascii %u */", c + 0x20);
+		for (unsigned i = 0 ; i < len ; i++)
+			printf("%s0x%02x,", i % 12 ? " " : "\n\t", buf[i]);
+		printf("\n");
+	}
+
+	printf("};\n\nconst PROGMEM uint16_t hershey_%s_offset[] = {", name);
+	for (unsigned c = 0 ; c < GLYPH_COUNT ; c++)
+		printf("%s%u,", c % 12 ? " " : "\n\t", offset[c]);
+
+	printf("\n};\n\nconst PROGMEM uint8_t hershey_%s_lod[] = {\n", name);
+	for (unsigned c = 0 ; c < GLYPH_COUNT ; c++)
+	{
+		printf("\t");
+		for (unsigned s = 0 ; s < HERSHEY_LOD_SCALES ; s++)
+		{
+			uint8_t mask[MAX_ENTRIES / 8] = { 0 };
+			glyph_lod(&font[c], lod_scale[s], mask, &drawn[s]);
+			for (unsigned i = 0 ; i < lod_bytes ; i++)
+				printf("0x%02x, ", mask[i]);
+		}
+		printf("/* Ascii %u */\n", c + 0x20);
+	}
+	printf("};\n\n");
+
+	char bbox_name[64];
+	snprintf(bbox_name, sizeof(bbox_name), "hershey_%s", name);
+	bbox_print(bbox_name, font);
+
+	printf(
+"\n"
+"const PROGMEM hershey_font_t hershey_%s_font = {\n"
+"\thershey_%s_data,\n"
+"\thershey_%s_offset,\n"
+"\thershey_%s_lod,\n"
+"\t%u,\n"
+"\thershey_%s_bbox,\n"
+"};\n",
+		name,
+		name,
+		name,
+		name,
+		lod_bytes,
+		name
+	);
+
+	fprintf(stderr, "%s: pen-up travel %u -> %u, %u bytes (%zu uncompressed)\n",
+		name,
+		before,
+		after,
+		total + GLYPH_COUNT * (2 + HERSHEY_LOD_SCALES * lod_bytes),
+		GLYPH_COUNT * sizeof(hershey_char_t)
+	);
+
+	for (unsigned s = 0 ; s < HERSHEY_LOD_SCALES ; s++)
+		fprintf(stderr, "%s: LOD scale %u draws %u of %u points\n",
+			name,
+			s,
+			drawn[s],
+			points
+		);
+
+	free(font);
+	return 0;
+}
+
+
+/** Convert the asteroids font the same way font.c decodes it */
+static int
+bbox(void)
+{
+	flat_t * const font = calloc(GLYPH_COUNT, sizeof(*font));
+
+	for (unsigned c = 0 ; c < GLYPH_COUNT ; c++)
+	{
+		flat_t * const f = &font[c];
+		f->width = 20;
+
+		for (unsigned i = 0 ; i < 8 ; i++)
+		{
+			const uint8_t xy = asteroids_font[c].points[i];
+			if (xy == 0xFF)
+				break;
+
+			f->up[f->count] = xy == 0xFE;
+			f->p[f->count] = (pt_t) {
+				((xy >> 4) & 0xF) * 2,
+				((xy >> 0) & 0xF) * 2,
+			};
+			f->count++;
+		}
+	}
+
+	printf(
+"/** \\file\n"
+" * Bounding boxes of the asteroids font glyphs.\n"
+" *\n"
+" * Generated by \"./fontgen bbox\"; do not edit by hand.\n"
+" */\n"
+"#include <stdint.h>\n"
+"#include \"memspaces.h\"\n"
+"#include \"asteroids-font.h\"\n"
+"\n"
+	);
+
+	bbox_print("asteroids_font", font);
+
+	free(font);
+	return 0;
+}
+
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+		"Usage: fontgen optimize > hershey.c\n"
+		"       fontgen compress name [font.jhf] > hershey-name.c\n"
+		"       fontgen bbox > asteroids-bbox.c\n"
+	);
+	exit(EXIT_FAILURE);
+}
+
+
+int
+main(
+	int argc,
+	char ** argv
+)
+{
+	if (argc < 2)
+		usage();
+
+	if (strcmp(argv[1], "optimize") == 0)
+		return optimize();
+	if (strcmp(argv[1], "compress") == 0 && (argc == 3 || argc == 4))
+		return compress(argv[2], argc == 4 ? argv[3] : NULL);
+	if (strcmp(argv[1], "bbox") == 0)
+		return bbox();
+
+	usage();
+	return EXIT_FAILURE;
+}
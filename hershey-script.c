@@ -0,0 +1,560 @@
+/** \file
+ * Compressed Hershey script font.
+ *
+ * Generated by "./fontgen compress script scripts.jhf"; do not edit by hand.
+ */
+#include <stdint.h>
+#include "memspaces.h"
+#include "hershey.h"
+
+const PROGMEM uint8_t hershey_script_data[] = {
+	/* Ascii 32 */
+	0x10, 0x80,
+	/* Ascii 33 */
+	0x0a, 0x82, 0x05, 0x15, 0x82, 0x05, 0x07, 0x81, 0x0b, 0xff, 0x1f, 0x11,
+	0xf1, 0x80,
+	/* Ascii 34 */
+	0x10, 0x82, 0x0c, 0x0e, 0x07, 0x81, 0x82, 0x04, 0x15, 0x09, 0x80,
+	/* Ascii 35 */
+	0x16, 0x82, 0x13, 0x0a, 0x82, 0x03, 0x0a, 0x81, 0x0a, 0x82, 0x13, 0x04,
+	0x81, 0x82, 0x0e, 0xf9, 0x82, 0x0e, 0x15, 0x81, 0xa0, 0x82, 0x08, 0xf9,
+	0x80,
+	/* Ascii 36 */
+	0x14, 0x33, 0x2e, 0x3f, 0x40, 0x31, 0x22, 0x03, 0xf2, 0xf1, 0xe1, 0xa2,
+	0xe1, 0xf1, 0xf2, 0x02, 0x22, 0x31, 0x40, 0x3f, 0x2e, 0x81, 0xb7, 0x82,
+	0x0c, 0xfc, 0x81, 0xc0, 0x82, 0x08, 0x19, 0x80,
+	/* Ascii 37 */
+	0x18, 0x82, 0x0e, 0x02, 0x2e, 0x20, 0x21, 0x12, 0x02, 0xe2, 0xe0, 0xef,
+	0xfe, 0x0e, 0x81, 0x82, 0x03, 0x00, 0x82, 0x15, 0x15, 0x81, 0x00, 0xef,
+	0xdf, 0xd0, 0xd1, 0xe1, 0xe0, 0xef, 0xfe, 0x0e, 0x2e, 0x20, 0x21, 0x12,
+	0x02, 0xe2, 0x80,
+	/* Ascii 38 */
+	0x1a, 0x82, 0x17, 0x0c, 0x01, 0xf1, 0xf0, 0xff, 0xfe, 0xeb, 0xed, 0xee,
+	0xef, 0xc0, 0xe1, 0xf1, 0xf2, 0x02, 0x12, 0x11, 0x74, 0x11, 0x12, 0x02,
+	0xf2, 0xe1, 0xef, 0xfe, 0x0e, 0x1d, 0x2d, 0x59, 0x2e, 0x2f, 0x20, 0x11,
+	0x01, 0x80,
+	/* Ascii 39 */
+	0x08, 0x82, 0x04, 0x15, 0x09, 0x80,
+	/* Ascii 40 */
+	0x0e, 0x82, 0x0b, 0x19, 0xee, 0xed, 0xec, 0xfb, 0x0c, 0x1b, 0x2c, 0x2d,
+	0x2e, 0x80,
+	/* Ascii 41 */
+	0x0e, 0x82, 0x03, 0x19, 0x2e, 0x2d, 0x2c, 0x1b, 0x0c, 0xfb, 0xec, 0xed,
+	0xee, 0x80,
+	/* Ascii 42 */
+	0x10, 0x36, 0x82, 0x0d, 0x0c, 0x81, 0x0a, 0x82, 0x03, 0x0c, 0x81, 0x53,
+	0x82, 0x08, 0x03, 0x80,
+	/* Ascii 43 */
+	0x1a, 0x82, 0x0d, 0x12, 0x82, 0x0d, 0x00, 0x81, 0x82, 0x04, 0x09, 0x82,
+	0x16, 0x09, 0x80,
+	/* Ascii 44 */
+	0x0a, 0x61, 0xff, 0xf1, 0x11, 0x1f, 0x0e, 0xfe, 0xff, 0x80,
+	/* Ascii 45 */
+	0x1a, 0x82, 0x04, 0x09, 0x82, 0x16, 0x09, 0x80,
+	/* Ascii 46 */
+	0x0a, 0x52, 0xff, 0x1f, 0x11, 0xf1, 0x80,
+	/* Ascii 47 */
+	0x16, 0x82, 0x14, 0x19, 0x82, 0x02, 0xf9, 0x80,
+	/* Ascii 48 */
+	0x14, 0x82, 0x09, 0x15, 0xdf, 0xed, 0xfb, 0x0d, 0x1b, 0x2d, 0x3f, 0x20,
+	0x31, 0x23, 0x15, 0x03, 0xf5, 0xe3, 0xd1, 0xe0, 0x80,
+	/* Ascii 49 */
+	0x14, 0x82, 0x06, 0x11, 0x21, 0x33, 0x82, 0x0b, 0x00, 0x80,
+	/* Ascii 50 */
+	0x14, 0x82, 0x04, 0x10, 0x01, 0x12, 0x11, 0x21, 0x40, 0x2f, 0x1f, 0x1e,
+	0x0e, 0xfe, 0xed, 0x82, 0x03, 0x00, 0x82, 0x11, 0x00, 0x80,
+	/* Ascii 51 */
+	0x14, 0x82, 0x05, 0x15, 0x82, 0x10, 0x15, 0xa8, 0x30, 0x2f, 0x1f, 0x1d,
+	0x0e, 0xfd, 0xee, 0xdf, 0xd0, 0xd1, 0xf1, 0xf2, 0x80,
+	/* Ascii 52 */
+	0x14, 0x82, 0x0d, 0x00, 0x82, 0x0d, 0x15, 0x81, 0x00, 0x82, 0x03, 0x07,
+	0x82, 0x12, 0x07, 0x80,
+	/* Ascii 53 */
+	0x14, 0x82, 0x0f, 0x15, 0x82, 0x05, 0x15, 0x82, 0x04, 0x0c, 0x11, 0x31,
+	0x30, 0x3f, 0x2e, 0x1d, 0x0e, 0xfd, 0xee, 0xdf, 0xd0, 0xd1, 0xf1, 0xf2,
+	0x80,
+	/* Ascii 54 */
+	0x14, 0x82, 0x10, 0x12, 0xf2, 0xd1, 0xe0, 0xdf, 0xed, 0xfb, 0x0b, 0x1c,
+	0x2e, 0x3f, 0x10, 0x31, 0x22, 0x13, 0x01, 0xf3, 0xe2, 0xd1, 0xf0, 0xdf,
+	0xee, 0xfd, 0x80,
+	/* Ascii 55 */
+	0x14, 0x82, 0x03, 0x15, 0x82, 0x11, 0x15, 0x81, 0x00, 0x82, 0x07, 0x00,
+	0x80,
+	/* Ascii 56 */
+	0x14, 0x82, 0x08, 0x15, 0xdf, 0xfe, 0x0e, 0x1e, 0x2f, 0x4f, 0x3f, 0x2e,
+	0x1e, 0x0d, 0xfe, 0xff, 0xdf, 0xc0, 0xd1, 0xf1, 0xf2, 0x03, 0x12, 0x22,
+	0x31, 0x41, 0x21, 0x12, 0x02, 0xf2, 0xd1, 0xc0, 0x80,
+	/* Ascii 57 */
+	0x14, 0x82, 0x10, 0x0e, 0xfd, 0xee, 0xdf, 0xf0, 0xd1, 0xe2, 0xf3, 0x01,
+	0x13, 0x22, 0x31, 0x10, 0x3f, 0x2e, 0x1c, 0x0b, 0xfb, 0xed, 0xdf, 0xe0,
+	0xd1, 0xf2, 0x80,
+	/* Ascii 58 */
+	0x0a, 0x52, 0xff, 0x1f, 0x11, 0xf1, 0x81, 0x82, 0x05, 0x0c, 0x11, 0xf1,
+	0xff, 0x1f, 0x80,
+	/* Ascii 59 */
+	0x0a, 0x4c, 0x11, 0x12, 0x02, 0xf1, 0xff, 0x1f, 0x11, 0x81, 0x82, 0x05,
+	0x0c, 0x11, 0xf1, 0xff, 0x1f, 0x80,
+	/* Ascii 60 */
+	0x18, 0x82, 0x14, 0x12, 0x82, 0x04, 0x09, 0x82, 0x14, 0x00, 0x80,
+	/* Ascii 61 */
+	0x1a, 0x82, 0x16, 0x06, 0x82, 0x04, 0x06, 0x81, 0x06, 0x82, 0x16, 0x0c,
+	0x80,
+	/* Ascii 62 */
+	0x18, 0x82, 0x04, 0x12, 0x82, 0x14, 0x09, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 63 */
+	0x12, 0x82, 0x03, 0x10, 0x01, 0x12, 0x11, 0x21, 0x40, 0x2f, 0x1f, 0x1e,
+	0x0e, 0xfe, 0xff, 0xce, 0x0d, 0x81, 0x0b, 0xff, 0x1f, 0x11, 0xf1, 0x80,
+	/* Ascii 64 */
+	0x1d, 0x82, 0x15, 0x02, 0xef, 0xdf, 0xd0, 0xd1, 0xe1, 0xe2, 0xf2, 0xf3,
+	0x03, 0x13, 0x12, 0x22, 0x21, 0x31, 0x30, 0x3f, 0x2f, 0x2e, 0x1e, 0x1d,
+	0x0c, 0xfe, 0xff, 0xe0, 0xf1, 0xf2, 0x82, 0x13, 0x10, 0x81, 0x0d, 0xf2,
+	0xe1, 0xd0, 0xef, 0xff, 0xfe, 0x0d, 0x1e, 0x1f, 0x2f, 0x30, 0x21, 0x12,
+	0x80,
+	/* Ascii 65 */
+	0x14, 0x00, 0x21, 0x33, 0x34, 0x47, 0x36, 0x82, 0x0f, 0x00, 0xf3, 0xe3,
+	0xe2, 0xd2, 0xe0, 0xff, 0x0e, 0x1e, 0x2e, 0x3e, 0x3f, 0x50, 0x80,
+	/* Ascii 66 */
+	0x17, 0x82, 0x0d, 0x13, 0x1f, 0x0d, 0xfc, 0xfd, 0xfe, 0xed, 0xee, 0xef,
+	0xf0, 0xf1, 0x03, 0x15, 0x13, 0x12, 0x23, 0x22, 0x21, 0x31, 0x30, 0x2f,
+	0x1e, 0x0e, 0xfe, 0xff, 0xef, 0xdf, 0x81, 0xf0, 0x10, 0x3f, 0x1f, 0x1e,
+	0x0d, 0xfe, 0xff, 0xef, 0xd0, 0xe1, 0xf2, 0x80,
+	/* Ascii 67 */
+	0x14, 0x82, 0x0c, 0x0f, 0x0f, 0x1f, 0x20, 0x21, 0x12, 0x02, 0xf2, 0xe1,
+	0xd0, 0xdf, 0xee, 0xed, 0xfe, 0xfc, 0x0c, 0x1d, 0x1f, 0x2f, 0x20, 0x31,
+	0x22, 0x12, 0x80,
+	/* Ascii 68 */
+	0x17, 0x82, 0x0d, 0x15, 0xef, 0xfe, 0xfc, 0xfa, 0xfd, 0xfe, 0xee, 0xef,
+	0xe0, 0xf1, 0x02, 0x11, 0x20, 0x2f, 0x2e, 0x3f, 0x30, 0x31, 0x22, 0x24,
+	0x15, 0x04, 0xf3, 0xf1, 0xe1, 0xd0, 0xee, 0x0e, 0x1d, 0x2d, 0x2e, 0x3e,
+	0x2f, 0x80,
+	/* Ascii 69 */
+	0x14, 0x82, 0x0e, 0x11, 0x0f, 0x1f, 0x20, 0x11, 0x02, 0xf2, 0xd1, 0xc0,
+	0xdf, 0xfe, 0x0d, 0x1e, 0x1f, 0x3f, 0xd0, 0xdf, 0xff, 0xfe, 0x0d, 0x1e,
+	0x1f, 0x3f, 0x30, 0x31, 0x22, 0x12, 0x80,
+	/* Ascii 70 */
+	0x14, 0x82, 0x12, 0x0b, 0x82, 0x09, 0x0b, 0x81, 0x14, 0xe0, 0xe1, 0xf2,
+	0x12, 0x31, 0x30, 0x4f, 0x30, 0x21, 0x81, 0xbf, 0xe9, 0xea, 0xec, 0xee,
+	0xef, 0xe0, 0xe1, 0xf2, 0x02, 0x11, 0x20, 0x2f, 0x80,
+	/* Ascii 71 */
+	0x17, 0x00, 0x21, 0x44, 0x35, 0x13, 0x14, 0x03, 0xf1, 0xf0, 0xff, 0xfe,
+	0x0d, 0x1e, 0x2f, 0x40, 0x31, 0x11, 0x12, 0x0a, 0xfb, 0xfe, 0xee, 0xdf,
+	0xc0, 0xd1, 0xe2, 0xf2, 0x02, 0x80,
+	/* Ascii 72 */
+	0x18, 0x82, 0x16, 0x05, 0xed, 0xff, 0xef, 0xf0, 0xf1, 0x03, 0x15, 0x26,
+	0x24, 0x22, 0x10, 0x1f, 0x0f, 0xfe, 0xee, 0xde, 0xef, 0x82, 0x07, 0x09,
+	0x81, 0x05, 0xe1, 0xf2, 0x01, 0x12, 0x21, 0x10, 0x2f, 0x1e, 0x0e, 0xfc,
+	0xea, 0xec, 0xee, 0xe0, 0xf1, 0x02, 0x80,
+	/* Ascii 73 */
+	0x11, 0x82, 0x0e, 0x05, 0xe2, 0xe3, 0xf2, 0xf3, 0x03, 0x12, 0x11, 0x20,
+	0x1f, 0x1e, 0x0d, 0xfb, 0xeb, 0xfe, 0xee, 0xef, 0xe0, 0xe1, 0xf2, 0x02,
+	0x11, 0x20, 0x2f, 0x80,
+	/* Ascii 74 */
+	0x0f, 0x82, 0x0a, 0xfd, 0xe3, 0xe5, 0xf6, 0x06, 0x13, 0x21, 0x20, 0x1f,
+	0x1d, 0x0d, 0xfb, 0x82, 0x05, 0xf7, 0xfe, 0xef, 0xf1, 0x02, 0x13, 0x23,
+	0x22, 0x32, 0x42, 0x80,
+	/* Ascii 75 */
+	0x18, 0x82, 0x0c, 0x0c, 0x1e, 0x09, 0x1e, 0x1f, 0x10, 0x21, 0x11, 0x23,
+	0x81, 0x82, 0x18, 0x12, 0x02, 0xf1, 0xf0, 0xef, 0xee, 0xed, 0xee, 0xef,
+	0xe0, 0x81, 0xd2, 0xe1, 0xf2, 0x01, 0x12, 0x21, 0x10, 0x2f, 0x1e, 0x0e,
+	0xfc, 0xea, 0xec, 0xee, 0xe0, 0xf1, 0x02, 0x80,
+	/* Ascii 76 */
+	0x13, 0x82, 0x04, 0x09, 0x20, 0x41, 0x32, 0x22, 0x12, 0x03, 0xf2, 0xe0,
+	0xff, 0xfe, 0x82, 0x09, 0x08, 0xfd, 0xfe, 0xee, 0xef, 0xe0, 0xf1, 0x02,
+	0x11, 0x20, 0x2f, 0x3e, 0x3f, 0x20, 0x31, 0x22, 0x80,
+	/* Ascii 77 */
+	0x21, 0x82, 0x05, 0x0e, 0xe1, 0xf2, 0x01, 0x12, 0x21, 0x10, 0x2f, 0x1e,
+	0x0e, 0xfb, 0xfc, 0xe9, 0x81, 0x27, 0x82, 0x0a, 0x0f, 0x24, 0x11, 0x21,
+	0x10, 0x2f, 0x1e, 0x0e, 0xfb, 0xfc, 0xe9, 0x81, 0x27, 0x82, 0x14, 0x0f,
+	0x24, 0x11, 0x21, 0x10, 0x2f, 0x1e, 0x0e, 0xfb, 0xe9, 0x0d, 0x1f, 0x10,
+	0x21, 0x11, 0x23, 0x80,
+	/* Ascii 78 */
+	0x18, 0x82, 0x05, 0x0e, 0xe1, 0xf2, 0x01, 0x12, 0x21, 0x10, 0x2f, 0x1e,
+	0x0e, 0xfb, 0xfc, 0xe9, 0x81, 0x27, 0x82, 0x0a, 0x0f, 0x24, 0x11, 0x21,
+	0x20, 0x2f, 0x1e, 0x0e, 0xfb, 0xe9, 0x0d, 0x1f, 0x10, 0x21, 0x11, 0x23,
+	0x80,
+	/* Ascii 79 */
+	0x15, 0x82, 0x0c, 0x15, 0xdf, 0xee, 0xed, 0xfe, 0xfc, 0x0c, 0x1d, 0x1f,
+	0x2f, 0x20, 0x31, 0x22, 0x23, 0x12, 0x14, 0x04, 0xf3, 0xf1, 0xe1, 0xe0,
+	0xee, 0x0d, 0x1d, 0x2d, 0x2e, 0x3e, 0x2f, 0x80,
+	/* Ascii 80 */
+	0x19, 0x82, 0x0d, 0x13, 0x1f, 0x0d, 0xfc, 0xfd, 0xfe, 0xed, 0xee, 0xef,
+	0xf0, 0xf1, 0x03, 0x15, 0x13, 0x12, 0x23, 0x22, 0x21, 0x31, 0x50, 0x2f,
+	0x1f, 0x1e, 0x0d, 0xfe, 0xff, 0xef, 0xd0, 0xe1, 0xf1, 0x80,
+	/* Ascii 81 */
+	0x16, 0x82, 0x0d, 0x0f, 0xfe, 0xff, 0xef, 0xe0, 0xf2, 0x02, 0x13, 0x22,
+	0x31, 0x30, 0x2f, 0x1e, 0x0c, 0xfd, 0xed, 0xcc, 0xde, 0xef, 0xdf, 0xe0,
+	0xf1, 0x02, 0x11, 0x20, 0x2f, 0x3e, 0x3f, 0x30, 0x31, 0x22, 0x80,
+	/* Ascii 82 */
+	0x19, 0x82, 0x0d, 0x13, 0x1f, 0x0d, 0xfc, 0xfd, 0xfe, 0xed, 0xee, 0xef,
+	0xf0, 0xf1, 0x03, 0x15, 0x13, 0x12, 0x23, 0x22, 0x21, 0x31, 0x40, 0x2f,
+	0x1f, 0x1e, 0x0d, 0xfe, 0xff, 0xef, 0xd0, 0xd1, 0x1f, 0x1e, 0x0b, 0x1e,
+	0x2f, 0x21, 0x11, 0x23, 0x80,
+	/* Ascii 83 */
+	0x14, 0x00, 0x21, 0x22, 0x34, 0x23, 0x24, 0x13, 0x03, 0xf1, 0xf0, 0xff,
+	0xfe, 0x0e, 0x1e, 0x2e, 0x3e, 0x2e, 0x1e, 0x0e, 0xfe, 0xff, 0xdf, 0xc0,
+	0xd1, 0xe2, 0xf2, 0x02, 0x80,
+	/* Ascii 84 */
+	0x13, 0x82, 0x0a, 0x0f, 0xe0, 0xe1, 0xf2, 0x12, 0x31, 0x30, 0x4f, 0x30,
+	0x21, 0x81, 0xbf, 0xe9, 0xea, 0xec, 0xee, 0xef, 0xe0, 0xe1, 0xf2, 0x02,
+	0x11, 0x20, 0x2f, 0x80,
+	/* Ascii 85 */
+	0x18, 0x82, 0x05, 0x0e, 0xe1, 0xf2, 0x01, 0x12, 0x21, 0x10, 0x2f, 0x1e,
+	0x0e, 0xfc, 0xfd, 0xfc, 0x0e, 0x1e, 0x2f, 0x20, 0x21, 0x11, 0x24, 0x82,
+	0x13, 0x0e, 0x27, 0x81, 0xe9, 0xfc, 0xfa, 0x0d, 0x1f, 0x10, 0x21, 0x11,
+	0x23, 0x80,
+	/* Ascii 86 */
+	0x17, 0x82, 0x05, 0x0e, 0xe1, 0xf2, 0x01, 0x12, 0x21, 0x10, 0x2f, 0x1e,
+	0x0e, 0xfc, 0xfd, 0xfc, 0x0d, 0x1e, 0x20, 0x21, 0x33, 0x23, 0x24, 0x13,
+	0x14, 0x02, 0xf1, 0xf0, 0xff, 0xfe, 0x0e, 0x1d, 0x2e, 0x2f, 0x80,
+	/* Ascii 87 */
+	0x1c, 0x82, 0x1e, 0x15, 0xef, 0xdd, 0xdc, 0xda, 0xd9, 0x81, 0x00, 0x82,
+	0x12, 0x15, 0x81, 0x00, 0x82, 0x08, 0x00, 0x81, 0x00, 0x82, 0x09, 0x0f,
+	0x03, 0xf2, 0xe1, 0xf0, 0xef, 0xfe, 0x0f, 0x1e, 0x2f, 0x80,
+	/* Ascii 88 */
+	0x18, 0x13, 0x0e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x82, 0x0e, 0x0f, 0x23,
+	0x22, 0x21, 0x20, 0x1f, 0x0e, 0x81, 0x82, 0x08, 0x0f, 0xe0, 0xf1, 0x02,
+	0x12, 0x21, 0x20, 0x2f, 0x1e, 0x0d, 0x82, 0x0b, 0x06, 0x0d, 0x1e, 0x2f,
+	0x20, 0x21, 0x12, 0x02, 0xf1, 0xe0, 0x80,
+	/* Ascii 89 */
+	0x17, 0x82, 0x05, 0x0e, 0xe1, 0xf2, 0x01, 0x12, 0x21, 0x10, 0x2f, 0x1e,
+	0x0e, 0xfc, 0xfd, 0xfc, 0x0e, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x12,
+	0x26, 0x81, 0x27, 0xe9, 0x82, 0x10, 0x04, 0xea, 0xeb, 0xec, 0xef, 0xf1,
+	0x02, 0x13, 0x23, 0x33, 0x32, 0x53, 0x80,
+	/* Ascii 90 */
+	0x15, 0x82, 0x0d, 0x0f, 0xfe, 0xff, 0xef, 0xe0, 0xf2, 0x02, 0x13, 0x22,
+	0x31, 0x30, 0x2f, 0x1e, 0x0c, 0xfd, 0xec, 0xdd, 0xcd, 0xef, 0xd0, 0xf1,
+	0x02, 0x11, 0x30, 0x2f, 0x1f, 0x1e, 0x0d, 0xfd, 0xfe, 0xed, 0xef, 0xf1,
+	0x02, 0x13, 0x23, 0x33, 0x32, 0x63, 0x80,
+	/* Ascii 91 */
+	0x0e, 0x82, 0x0b, 0xf9, 0x90, 0x81, 0x00, 0x82, 0x04, 0x19, 0x81, 0x00,
+	0x70, 0x80,
+	/* Ascii 92 */
+	0x16, 0x82, 0x02, 0x0f, 0x82, 0x14, 0xf9, 0x80,
+	/* Ascii 93 */
+	0x0e, 0x39, 0x70, 0x81, 0x00, 0x82, 0x0a, 0x19, 0x81, 0x00, 0x90, 0x80,
+	/* Ascii 94 */
+	0x16, 0x82, 0x13, 0x07, 0x82, 0x0b, 0x0b, 0x82, 0x03, 0x07, 0x81, 0x00,
+	0x82, 0x0b, 0x0c, 0x82, 0x13, 0x07, 0x80,
+	/* Ascii 95 */
+	0x12, 0x10, 0x82, 0x11, 0x00, 0x80,
+	/* Ascii 96 */
+	0x0c, 0x82, 0x09, 0x0f, 0xa5, 0x11, 0x81, 0x00, 0x5a, 0x80,
+	/* Ascii 97 */
+	0x10, 0x82, 0x09, 0x06, 0xf2, 0xe1, 0xe0, 0xef, 0xff, 0xfe, 0x0e, 0x1e,
+	0x2f, 0x20, 0x21, 0x12, 0x26, 0xfb, 0x0d, 0x1f, 0x10, 0x21, 0x11, 0x23,
+	0x80,
+	/* Ascii 98 */
+	0x0e, 0x05, 0x23, 0x35, 0x12, 0x13, 0x02, 0xf1, 0xef, 0xfe, 0xfc, 0xf9,
+	0x0a, 0x1f, 0x10, 0x21, 0x22, 0x13, 0x03, 0x1c, 0x1f, 0x20, 0x21, 0x80,
+	/* Ascii 99 */
+	0x0b, 0x77, 0x01, 0xf1, 0xe0, 0xef, 0xff, 0xfe, 0x0e, 0x1e, 0x2f, 0x30,
+	0x32, 0x23, 0x80,
+	/* Ascii 100 */
+	0x10, 0x82, 0x10, 0x05, 0xed, 0xff, 0xef, 0xf0, 0xf1, 0x03, 0x15, 0x81,
+	0xfd, 0xf2, 0xe1, 0xe0, 0xef, 0xff, 0xfe, 0x0e, 0x1e, 0x2f, 0x20, 0x21,
+	0x12, 0x82, 0x0e, 0x15, 0x80,
+	/* Ascii 101 */
+	0x0a, 0x12, 0x21, 0x11, 0x12, 0x02, 0xf1, 0xf0, 0xef, 0xfe, 0x0d, 0x1e,
+	0x2f, 0x20, 0x21, 0x11, 0x23, 0x80,
+	/* Ascii 102 */
+	0x08, 0x05, 0x45, 0x23, 0x12, 0x13, 0x02, 0xf1, 0xef, 0xfe, 0xe8, 0x82,
+	0xff, 0x01, 0xd9, 0xfd, 0x0e, 0x1f, 0x21, 0x13, 0x82, 0x00, 0x01, 0x1f,
+	0x20, 0x21, 0x11, 0x23, 0x80,
+	/* Ascii 103 */
+	0x0f, 0x82, 0x0f, 0x05, 0xdd, 0xde, 0xef, 0xde, 0xdd, 0xfd, 0x0e, 0x1f,
+	0x21, 0x12, 0x82, 0x08, 0x02, 0x27, 0x81, 0xfd, 0xf2, 0xe1, 0xe0, 0xef,
+	0xff, 0xfe, 0x0e, 0x1e, 0x2f, 0x20, 0x21, 0x11, 0x80,
+	/* Ascii 104 */
+	0x0f, 0x05, 0x23, 0x35, 0x12, 0x13, 0x02, 0xf1, 0xef, 0xfe, 0xfc, 0xfa,
+	0xf8, 0x81, 0x00, 0x13, 0x12, 0x23, 0x21, 0x20, 0x1f, 0x0e, 0xfd, 0x0e,
+	0x1f, 0x10, 0x21, 0x11, 0x23, 0x80,
+	/* Ascii 105 */
+	0x07, 0x75, 0xed, 0xff, 0xef, 0xf0, 0xf1, 0x02, 0x26, 0xec, 0x81, 0x82,
+	0x03, 0x0d, 0x10, 0x01, 0xf0, 0x0f, 0x80,
+	/* Ascii 106 */
+	0x07, 0x75, 0xdd, 0xde, 0xef, 0xde, 0xdd, 0xfd, 0x0e, 0x1f, 0x21, 0x12,
+	0x82, 0x02, 0x09, 0xec, 0x81, 0x82, 0x03, 0x0d, 0x10, 0x01, 0xf0, 0x0f,
+	0x80,
+	/* Ascii 107 */
+	0x0e, 0x05, 0x23, 0x35, 0x12, 0x13, 0x02, 0xf1, 0xef, 0xfe, 0xfc, 0xfa,
+	0xf8, 0x81, 0x00, 0x13, 0x12, 0x23, 0x21, 0x20, 0x1f, 0x0e, 0xef, 0xd0,
+	0x81, 0x00, 0x2f, 0x1d, 0x1f, 0x10, 0x21, 0x11, 0x23, 0x80,
+	/* Ascii 108 */
+	0x08, 0x05, 0x23, 0x35, 0x12, 0x13, 0x02, 0xf1, 0xef, 0xfe, 0xfc, 0xf9,
+	0x0a, 0x1f, 0x10, 0x21, 0x11, 0x23, 0x80,
+	/* Ascii 109 */
+	0x19, 0x05, 0x23, 0x21, 0x1f, 0x0f, 0xfc, 0xfd, 0x81, 0x13, 0x12, 0x23,
+	0x21, 0x20, 0x1f, 0x0f, 0xfc, 0xfd, 0x81, 0x13, 0x12, 0x23, 0x21, 0x20,
+	0x1f, 0x0e, 0xfd, 0x0e, 0x1f, 0x10, 0x21, 0x11, 0x23, 0x80,
+	/* Ascii 110 */
+	0x12, 0x05, 0x23, 0x21, 0x1f, 0x0f, 0xfc, 0xfd, 0x81, 0x13, 0x12, 0x23,
+	0x21, 0x20, 0x1f, 0x0e, 0xfd, 0x0e, 0x1f, 0x10, 0x21, 0x11, 0x23, 0x80,
+	/* Ascii 111 */
+	0x0e, 0x82, 0x06, 0x09, 0xe0, 0xef, 0xff, 0xfe, 0x0e, 0x1e, 0x2f, 0x20,
+	0x21, 0x11, 0x12, 0x02, 0xf2, 0xe1, 0xff, 0x0e, 0x1e, 0x2f, 0x30, 0x21,
+	0x11, 0x80,
+	/* Ascii 112 */
+	0x0f, 0x82, 0x0f, 0x05, 0xdd, 0xef, 0xdf, 0xd0, 0xe1, 0x81, 0x4f, 0x21,
+	0x11, 0x12, 0x02, 0xf2, 0xe1, 0xe0, 0xef, 0xfe, 0x81, 0xef, 0x23, 0x12,
+	0xfc, 0x82, 0xfc, 0xf4, 0x80,
+	/* Ascii 113 */
+	0x0f, 0x82, 0x0f, 0x05, 0xdd, 0xde, 0xef, 0x09, 0xfd, 0xef, 0xf1, 0x02,
+	0x13, 0x37, 0x25, 0x13, 0x81, 0xfd, 0xf2, 0xe1, 0xe0, 0xef, 0xff, 0xfe,
+	0x0e, 0x1e, 0x2f, 0x20, 0x21, 0x80,
+	/* Ascii 114 */
+	0x0d, 0x05, 0x23, 0x12, 0x0e, 0x30, 0x1f, 0x0e, 0xfd, 0x0f, 0x1f, 0x10,
+	0x21, 0x11, 0x23, 0x80,
+	/* Ascii 115 */
+	0x0b, 0x82, 0x0b, 0x05, 0xed, 0xff, 0xef, 0xc0, 0xe1, 0x81, 0x04, 0x23,
+	0x12, 0x0e, 0x2d, 0x1e, 0x0e, 0xef, 0x80,
+	/* Ascii 116 */
+	0x09, 0x82, 0x07, 0x15, 0x82, 0x01, 0x03, 0x0e, 0x1f, 0x20, 0x21, 0x11,
+	0x23, 0x81, 0x82, 0x08, 0x0d, 0x90, 0x81, 0x3f, 0xec, 0xed, 0x80,
+	/* Ascii 117 */
+	0x0f, 0x05, 0x24, 0xea, 0x0e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x81, 0x13,
+	0xea, 0x0e, 0x1f, 0x10, 0x21, 0x11, 0x23, 0x80,
+	/* Ascii 118 */
+	0x0f, 0x05, 0x24, 0xfb, 0x0d, 0x1f, 0x10, 0x31, 0x22, 0x13, 0x03, 0x81,
+	0x00, 0x1c, 0x1f, 0x20, 0x21, 0x80,
+	/* Ascii 119 */
+	0x15, 0x82, 0x15, 0x05, 0xef, 0xe0, 0xf1, 0xf4, 0x81, 0x00, 0x0d, 0xfd,
+	0xee, 0xef, 0xe0, 0xf1, 0x02, 0x26, 0x81, 0xa0, 0xee, 0xfd, 0x0e, 0x1e,
+	0x20, 0x21, 0x22, 0x80,
+	/* Ascii 120 */
+	0x10, 0x82, 0x0d, 0x08, 0xf1, 0xe0, 0xff, 0xc9, 0xff, 0xe0, 0xf1, 0x81,
+	0xf4, 0x23, 0x21, 0x20, 0x1f, 0x09, 0x1f, 0x30, 0x32, 0x23, 0x80,
+	/* Ascii 121 */
+	0x0f, 0x05, 0x24, 0xea, 0x0e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x81, 0x13,
+	0x82, 0x04, 0xf7, 0xfe, 0xef, 0xf1, 0x02, 0x13, 0x33, 0x32, 0x21, 0x32,
+	0x33, 0x80,
+	/* Ascii 122 */
+	0x0e, 0x05, 0x23, 0x21, 0x20, 0x2e, 0x0e, 0xfe, 0xee, 0xdf, 0x2f, 0x1e,
+	0x0d, 0xfd, 0xfe, 0xef, 0xf1, 0x02, 0x13, 0x33, 0x32, 0x43, 0x33, 0x80,
+	/* Ascii 123 */
+	0x0e, 0x82, 0x09, 0x19, 0xdd, 0xfd, 0x0e, 0x1d, 0x2e, 0x0f, 0xce, 0x4e,
+	0x0f, 0xee, 0xfd, 0x0e, 0x1d, 0x3d, 0x80,
+	/* Ascii 124 */
+	0x08, 0x82, 0x04, 0x19, 0x82, 0x04, 0xf9, 0x80,
+	/* Ascii 125 */
+	0x0e, 0x82, 0x05, 0x19, 0x3d, 0x1d, 0x0e, 0xfd, 0xee, 0x0f, 0x4e, 0xce,
+	0x0f, 0x2e, 0x1d, 0x0e, 0xfd, 0xdd, 0x80,
+	/* Ascii 126 */
+	0x18, 0x82, 0x15, 0x0c, 0x0e, 0xfd, 0xef, 0xe0, 0xe1, 0xc3, 0xe1, 0xe0,
+	0xef, 0xfe, 0x81, 0x0e, 0x02, 0x13, 0x21, 0x20, 0x2f, 0x4d, 0x2f, 0x20,
+	0x21, 0x12, 0x80,
+};
+
+const PROGMEM uint16_t hershey_script_offset[] = {
+	0, 2, 16, 27, 52, 84, 123, 161, 167, 181, 195, 211,
+	226, 236, 244, 251, 259, 280, 290, 312, 333, 349, 374, 401,
+	414, 447, 474, 489, 507, 518, 531, 542, 566, 615, 638, 682,
+	709, 747, 778, 811, 841, 884, 912, 940, 984, 1017, 1069, 1106,
+	1138, 1172, 1207, 1248, 1277, 1305, 1343, 1378, 1412, 1455, 1498, 1541,
+	1555, 1563, 1575, 1594, 1600, 1610, 1635, 1659, 1674, 1703, 1721, 1750,
+	1783, 1813, 1832, 1857, 1891, 1910, 1944, 1968, 1994, 2023, 2053, 2069,
+	2088, 2111, 2131, 2149, 2177, 2200, 2226, 2250, 2269, 2277, 2296,
+};
+
+const PROGMEM uint8_t hershey_script_lod[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 32 */
+	0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 33 */
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 34 */
+	0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, /* Ascii 35 */
+	0x21, 0x20, 0xf9, 0x03, 0x00, 0x00, 0x25, 0x29, 0xf9, 0x03, 0x00, 0x00, /* Ascii 36 */
+	0x21, 0xfc, 0x20, 0x42, 0x00, 0x00, 0xa5, 0xfc, 0xa2, 0x52, 0x00, 0x00, /* Ascii 37 */
+	0x01, 0x22, 0x48, 0x04, 0x02, 0x00, 0x95, 0xa6, 0x48, 0xa5, 0x02, 0x00, /* Ascii 38 */
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 39 */
+	0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x51, 0x02, 0x00, 0x00, 0x00, 0x00, /* Ascii 40 */
+	0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x51, 0x02, 0x00, 0x00, 0x00, 0x00, /* Ascii 41 */
+	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 42 */
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 43 */
+	0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 44 */
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 45 */
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 46 */
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 47 */
+	0x11, 0x11, 0x01, 0x00, 0x00, 0x00, 0x55, 0x55, 0x01, 0x00, 0x00, 0x00, /* Ascii 48 */
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 49 */
+	0x11, 0x31, 0x00, 0x00, 0x00, 0x00, 0x31, 0x39, 0x00, 0x00, 0x00, 0x00, /* Ascii 50 */
+	0x87, 0x44, 0x00, 0x00, 0x00, 0x00, 0x97, 0x54, 0x00, 0x00, 0x00, 0x00, /* Ascii 51 */
+	0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 52 */
+	0x47, 0x04, 0x01, 0x00, 0x00, 0x00, 0x57, 0x25, 0x01, 0x00, 0x00, 0x00, /* Ascii 53 */
+	0x51, 0x11, 0x42, 0x00, 0x00, 0x00, 0x55, 0x55, 0x52, 0x00, 0x00, 0x00, /* Ascii 54 */
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 55 */
+	0x11, 0x22, 0x02, 0x11, 0x00, 0x00, 0x95, 0xaa, 0x12, 0x15, 0x00, 0x00, /* Ascii 56 */
+	0x21, 0x44, 0x45, 0x00, 0x00, 0x00, 0xa5, 0x54, 0x55, 0x00, 0x00, 0x00, /* Ascii 57 */
+	0x71, 0x04, 0x00, 0x00, 0x00, 0x00, 0x75, 0x05, 0x00, 0x00, 0x00, 0x00, /* Ascii 58 */
+	0x81, 0x23, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x2b, 0x00, 0x00, 0x00, 0x00, /* Ascii 59 */
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 60 */
+	0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 61 */
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 62 */
+	0x81, 0xe0, 0x08, 0x00, 0x00, 0x00, 0x91, 0xf2, 0x0a, 0x00, 0x00, 0x00, /* Ascii 63 */
+	0x11, 0x89, 0x88, 0x38, 0x88, 0x04, 0x15, 0x89, 0xa8, 0x3c, 0xa9, 0x04, /* Ascii 64 */
+	0x61, 0x24, 0x04, 0x00, 0x00, 0x00, 0x69, 0x24, 0x05, 0x00, 0x00, 0x00, /* Ascii 65 */
+	0x01, 0x82, 0x10, 0x1c, 0x82, 0x00, 0x11, 0x92, 0x94, 0x9c, 0xa4, 0x00, /* Ascii 66 */
+	0x91, 0x88, 0x44, 0x00, 0x00, 0x00, 0x95, 0x8a, 0x54, 0x00, 0x00, 0x00, /* Ascii 67 */
+	0x41, 0x04, 0x48, 0x24, 0x02, 0x00, 0x45, 0x15, 0x49, 0x2d, 0x02, 0x00, /* Ascii 68 */
+	0x41, 0x42, 0x88, 0x04, 0x00, 0x00, 0x55, 0x4a, 0xa9, 0x04, 0x00, 0x00, /* Ascii 69 */
+	0x8f, 0x70, 0x22, 0x04, 0x00, 0x00, 0xaf, 0x70, 0x2a, 0x05, 0x00, 0x00, /* Ascii 70 */
+	0x09, 0x11, 0x22, 0x09, 0x00, 0x00, 0x29, 0x55, 0x2a, 0x09, 0x00, 0x00, /* Ascii 71 */
+	0x21, 0x08, 0x1c, 0x84, 0x10, 0x00, 0x25, 0xa9, 0x9c, 0x94, 0x12, 0x00, /* Ascii 72 */
+	0x81, 0x10, 0x84, 0x00, 0x00, 0x00, 0x91, 0x24, 0xa5, 0x00, 0x00, 0x00, /* Ascii 73 */
+	0x41, 0x44, 0x20, 0x00, 0x00, 0x00, 0x59, 0x55, 0x25, 0x00, 0x00, 0x00, /* Ascii 74 */
+	0x11, 0x07, 0x38, 0x08, 0x21, 0x00, 0x11, 0x27, 0x3a, 0x29, 0x25, 0x00, /* Ascii 75 */
+	0x91, 0x20, 0x02, 0x04, 0x00, 0x00, 0x95, 0xa4, 0x8a, 0x04, 0x00, 0x00, /* Ascii 76 */
+	0x41, 0x70, 0x10, 0x0e, 0x41, 0x08, 0x49, 0x72, 0x51, 0x2e, 0x45, 0x0a, /* Ascii 77 */
+	0x41, 0x70, 0x08, 0x42, 0x00, 0x00, 0x49, 0x72, 0x29, 0x52, 0x00, 0x00, /* Ascii 78 */
+	0x91, 0x48, 0x90, 0x08, 0x00, 0x00, 0x91, 0x4a, 0xb2, 0x08, 0x00, 0x00, /* Ascii 79 */
+	0x01, 0x82, 0x20, 0x22, 0x00, 0x00, 0x11, 0x92, 0xa4, 0x2a, 0x00, 0x00, /* Ascii 80 */
+	0x91, 0x48, 0x20, 0x40, 0x00, 0x00, 0x91, 0x4a, 0xa2, 0x48, 0x00, 0x00, /* Ascii 81 */
+	0x21, 0x44, 0x44, 0x12, 0x11, 0x00, 0xa5, 0x44, 0x4c, 0x12, 0x15, 0x00, /* Ascii 82 */
+	0x01, 0x11, 0x88, 0x04, 0x00, 0x00, 0x51, 0x11, 0xa9, 0x04, 0x00, 0x00, /* Ascii 83 */
+	0x11, 0x4e, 0x84, 0x00, 0x00, 0x00, 0x15, 0x4e, 0xa5, 0x00, 0x00, 0x00, /* Ascii 84 */
+	0x41, 0x20, 0xe1, 0x84, 0x00, 0x00, 0x49, 0x21, 0xe9, 0xa4, 0x00, 0x00, /* Ascii 85 */
+	0x41, 0x40, 0x04, 0x41, 0x00, 0x00, 0x49, 0x51, 0x25, 0x49, 0x00, 0x00, /* Ascii 86 */
+	0xe1, 0x3f, 0x82, 0x00, 0x00, 0x00, 0xe9, 0xbf, 0x92, 0x00, 0x00, 0x00, /* Ascii 87 */
+	0x11, 0xe2, 0x48, 0x48, 0x04, 0x00, 0x15, 0xe5, 0x4a, 0x48, 0x05, 0x00, /* Ascii 88 */
+	0x41, 0x80, 0xe0, 0x20, 0x10, 0x00, 0x49, 0x91, 0xe4, 0xa4, 0x12, 0x00, /* Ascii 89 */
+	0x91, 0x24, 0x22, 0x84, 0x48, 0x00, 0x91, 0xb4, 0xaa, 0x94, 0x4a, 0x00, /* Ascii 90 */
+	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 91 */
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 92 */
+	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 93 */
+	0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 94 */
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 95 */
+	0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 96 */
+	0x89, 0x28, 0x11, 0x00, 0x00, 0x00, 0x89, 0x2a, 0x11, 0x00, 0x00, 0x00, /* Ascii 97 */
+	0x41, 0x08, 0x22, 0x00, 0x00, 0x00, 0x49, 0xa9, 0x2a, 0x00, 0x00, 0x00, /* Ascii 98 */
+	0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, /* Ascii 99 */
+	0x91, 0x13, 0x51, 0x00, 0x00, 0x00, 0x91, 0x13, 0x55, 0x00, 0x00, 0x00, /* Ascii 100 */
+	0x41, 0x84, 0x00, 0x00, 0x00, 0x00, 0x49, 0x95, 0x00, 0x00, 0x00, 0x00, /* Ascii 101 */
+	0x41, 0x40, 0x42, 0x00, 0x00, 0x00, 0x49, 0x49, 0x4b, 0x00, 0x00, 0x00, /* Ascii 102 */
+	0x01, 0x71, 0x10, 0x04, 0x00, 0x00, 0x21, 0x75, 0x92, 0x04, 0x00, 0x00, /* Ascii 103 */
+	0x41, 0x38, 0x82, 0x08, 0x00, 0x00, 0x49, 0x39, 0x8a, 0x08, 0x00, 0x00, /* Ascii 104 */
+	0x89, 0x47, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x47, 0x00, 0x00, 0x00, 0x00, /* Ascii 105 */
+	0x01, 0x79, 0x04, 0x00, 0x00, 0x00, 0x21, 0x7d, 0x04, 0x00, 0x00, 0x00, /* Ascii 106 */
+	0x41, 0x38, 0xc8, 0x89, 0x00, 0x00, 0x49, 0x39, 0xd9, 0x89, 0x00, 0x00, /* Ascii 107 */
+	0x41, 0x08, 0x01, 0x00, 0x00, 0x00, 0x49, 0x49, 0x01, 0x00, 0x00, 0x00, /* Ascii 108 */
+	0xc9, 0x11, 0x27, 0x88, 0x00, 0x00, 0xcb, 0x15, 0xa7, 0x88, 0x00, 0x00, /* Ascii 109 */
+	0xc9, 0x09, 0x22, 0x00, 0x00, 0x00, 0xcb, 0x29, 0x22, 0x00, 0x00, 0x00, /* Ascii 110 */
+	0x41, 0x44, 0x22, 0x00, 0x00, 0x00, 0x49, 0x55, 0x2a, 0x00, 0x00, 0x00, /* Ascii 111 */
+	0xe1, 0x10, 0x57, 0x00, 0x00, 0x00, 0xe9, 0x54, 0x57, 0x00, 0x00, 0x00, /* Ascii 112 */
+	0x41, 0x70, 0x10, 0x02, 0x00, 0x00, 0x59, 0x71, 0x52, 0x02, 0x00, 0x00, /* Ascii 113 */
+	0x05, 0x22, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x22, 0x00, 0x00, 0x00, 0x00, /* Ascii 114 */
+	0xe1, 0x42, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x52, 0x00, 0x00, 0x00, 0x00, /* Ascii 115 */
+	0x85, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x5f, 0x00, 0x00, 0x00, 0x00, /* Ascii 116 */
+	0x23, 0x27, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x27, 0x02, 0x00, 0x00, 0x00, /* Ascii 117 */
+	0x4b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xae, 0x00, 0x00, 0x00, 0x00, /* Ascii 118 */
+	0x71, 0xc8, 0x91, 0x00, 0x00, 0x00, 0x75, 0xc9, 0x95, 0x00, 0x00, 0x00, /* Ascii 119 */
+	0x81, 0x93, 0x04, 0x00, 0x00, 0x00, 0xa5, 0x93, 0x05, 0x00, 0x00, 0x00, /* Ascii 120 */
+	0x23, 0x27, 0x20, 0x00, 0x00, 0x00, 0x2b, 0x2f, 0x21, 0x00, 0x00, 0x00, /* Ascii 121 */
+	0x11, 0x40, 0x20, 0x00, 0x00, 0x00, 0x55, 0x49, 0x22, 0x00, 0x00, 0x00, /* Ascii 122 */
+	0x81, 0x40, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x51, 0x00, 0x00, 0x00, 0x00, /* Ascii 123 */
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 124 */
+	0x81, 0x40, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x51, 0x00, 0x00, 0x00, 0x00, /* Ascii 125 */
+	0x09, 0x9c, 0x40, 0x00, 0x00, 0x00, 0x89, 0x9c, 0x48, 0x00, 0x00, 0x00, /* Ascii 126 */
+};
+
+const PROGMEM glyph_bbox_t hershey_script_bbox[] = {
+	{   0,   0,  -1,  -1, }, /* Ascii 32 */
+	{   4,   0,   6,  21, }, /* Ascii 33 */
+	{   4,  14,  12,  21, }, /* Ascii 34 */
+	{   3,  -7,  19,  21, }, /* Ascii 35 */
+	{   3,  -4,  17,  25, }, /* Ascii 36 */
+	{   3,   0,  21,  21, }, /* Ascii 37 */
+	{   3,   0,  23,  21, }, /* Ascii 38 */
+	{   4,  14,   4,  21, }, /* Ascii 39 */
+	{   4,  -7,  11,  25, }, /* Ascii 40 */
+	{   3,  -7,  10,  25, }, /* Ascii 41 */
+	{   3,   3,  13,  15, }, /* Ascii 42 */
+	{   4,   0,  22,  18, }, /* Ascii 43 */
+	{   4,  -4,   6,   2, }, /* Ascii 44 */
+	{   4,   9,  22,   9, }, /* Ascii 45 */
+	{   4,   0,   6,   2, }, /* Ascii 46 */
+	{   2,  -7,  20,  25, }, /* Ascii 47 */
+	{   3,   0,  17,  21, }, /* Ascii 48 */
+	{   6,   0,  11,  21, }, /* Ascii 49 */
+	{   3,   0,  17,  21, }, /* Ascii 50 */
+	{   3,   0,  17,  21, }, /* Ascii 51 */
+	{   3,   0,  18,  21, }, /* Ascii 52 */
+	{   3,   0,  17,  21, }, /* Ascii 53 */
+	{   4,   0,  17,  21, }, /* Ascii 54 */
+	{   3,   0,  17,  21, }, /* Ascii 55 */
+	{   3,   0,  17,  21, }, /* Ascii 56 */
+	{   3,   0,  16,  21, }, /* Ascii 57 */
+	{   4,   0,   6,  14, }, /* Ascii 58 */
+	{   4,  -4,   6,  14, }, /* Ascii 59 */
+	{   4,   0,  20,  18, }, /* Ascii 60 */
+	{   4,   6,  22,  12, }, /* Ascii 61 */
+	{   4,   0,  20,  18, }, /* Ascii 62 */
+	{   3,   0,  15,  21, }, /* Ascii 63 */
+	{   4,   0,  25,  21, }, /* Ascii 64 */
+	{   0,   0,  18,  21, }, /* Ascii 65 */
+	{   3,   0,  21,  21, }, /* Ascii 66 */
+	{   3,   0,  18,  21, }, /* Ascii 67 */
+	{  -1,   0,  21,  21, }, /* Ascii 68 */
+	{   3,   0,  18,  21, }, /* Ascii 69 */
+	{   1,   0,  21,  21, }, /* Ascii 70 */
+	{   0,   0,  19,  21, }, /* Ascii 71 */
+	{   1,   0,  24,  21, }, /* Ascii 72 */
+	{   1,   0,  14,  21, }, /* Ascii 73 */
+	{   1, -12,  13,  21, }, /* Ascii 74 */
+	{   1,   0,  24,  21, }, /* Ascii 75 */
+	{   0,   0,  18,  21, }, /* Ascii 76 */
+	{   2,   0,  33,  21, }, /* Ascii 77 */
+	{   2,   0,  24,  21, }, /* Ascii 78 */
+	{   3,   0,  20,  21, }, /* Ascii 79 */
+	{   3,   0,  24,  21, }, /* Ascii 80 */
+	{   0,   0,  19,  21, }, /* Ascii 81 */
+	{   3,   0,  23,  21, }, /* Ascii 82 */
+	{   0,   0,  17,  21, }, /* Ascii 83 */
+	{   1,   0,  21,  21, }, /* Ascii 84 */
+	{   2,   0,  24,  21, }, /* Ascii 85 */
+	{   2,   0,  21,  21, }, /* Ascii 86 */
+	{   2,   0,  30,  21, }, /* Ascii 87 */
+	{   1,   0,  23,  21, }, /* Ascii 88 */
+	{   2, -12,  21,  21, }, /* Ascii 89 */
+	{   2, -12,  18,  21, }, /* Ascii 90 */
+	{   4,  -7,  11,  25, }, /* Ascii 91 */
+	{   2,  -7,  20,  15, }, /* Ascii 92 */
+	{   3,  -7,  10,  25, }, /* Ascii 93 */
+	{   3,   7,  19,  12, }, /* Ascii 94 */
+	{   1,   0,  17,   0, }, /* Ascii 95 */
+	{   3,  15,   9,  21, }, /* Ascii 96 */
+	{   0,   0,  16,   9, }, /* Ascii 97 */
+	{   0,   0,  14,  21, }, /* Ascii 98 */
+	{   0,   0,  11,   9, }, /* Ascii 99 */
+	{   0,   0,  16,  21, }, /* Ascii 100 */
+	{   0,   0,  10,   9, }, /* Ascii 101 */
+	{  -5, -12,   8,  21, }, /* Ascii 102 */
+	{   0, -12,  15,   9, }, /* Ascii 103 */
+	{   0,   0,  15,  21, }, /* Ascii 104 */
+	{   0,   0,   7,  14, }, /* Ascii 105 */
+	{  -8, -12,   7,  14, }, /* Ascii 106 */
+	{   0,   0,  14,  21, }, /* Ascii 107 */
+	{   0,   0,   8,  21, }, /* Ascii 108 */
+	{   0,   0,  25,   9, }, /* Ascii 109 */
+	{   0,   0,  18,   9, }, /* Ascii 110 */
+	{   0,   0,  14,   9, }, /* Ascii 111 */
+	{  -4, -12,  15,  10, }, /* Ascii 112 */
+	{   0, -12,  15,   9, }, /* Ascii 113 */
+	{   0,   0,  13,  10, }, /* Ascii 114 */
+	{   0,   0,  11,  10, }, /* Ascii 115 */
+	{   0,   0,   9,  21, }, /* Ascii 116 */
+	{   0,   0,  15,   9, }, /* Ascii 117 */
+	{   0,   0,  15,   9, }, /* Ascii 118 */
+	{   0,   0,  21,   9, }, /* Ascii 119 */
+	{   0,   0,  16,   9, }, /* Ascii 120 */
+	{   0, -12,  15,   9, }, /* Ascii 121 */
+	{   0, -12,  14,   9, }, /* Ascii 122 */
+	{   4,  -7,   9,  25, }, /* Ascii 123 */
+	{   4,  -7,   4,  25, }, /* Ascii 124 */
+	{   5,  -7,  10,  25, }, /* Ascii 125 */
+	{   3,   6,  21,  12, }, /* Ascii 126 */
+};
+
+const PROGMEM hershey_font_t hershey_script_font = {
+	hershey_script_data,
+	hershey_script_offset,
+	hershey_script_lod,
+	6,
+	hershey_script_bbox,
+};
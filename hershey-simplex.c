@@ -0,0 +1,507 @@
+/** \file
+ * Compressed Hershey simplex font.
+ *
+ * Generated by "./fontgen compress simplex"; do not edit by hand.
+ */
+#include <stdint.h>
+#include "memspaces.h"
+#include "hershey.h"
+
+const PROGMEM uint8_t hershey_simplex_data[] = {
+	/* Ascii 32 */
+	0x10, 0x80,
+	/* Ascii 33 */
+	0x0a, 0x82, 0x05, 0x15, 0x82, 0x05, 0x07, 0x81, 0x0b, 0xff, 0x1f, 0x11,
+	0xf1, 0x80,
+	/* Ascii 34 */
+	0x10, 0x82, 0x0c, 0x0e, 0x07, 0x81, 0x82, 0x04, 0x15, 0x09, 0x80,
+	/* Ascii 35 */
+	0x15, 0x82, 0x11, 0x06, 0x82, 0x03, 0x06, 0x81, 0x16, 0x82, 0x12, 0x0c,
+	0x81, 0x82, 0x11, 0x19, 0x82, 0x0a, 0xf9, 0x81, 0xa0, 0x82, 0x0b, 0x19,
+	0x80,
+	/* Ascii 36 */
+	0x14, 0x33, 0x2e, 0x3f, 0x40, 0x31, 0x22, 0x03, 0xf2, 0xf1, 0xe1, 0xa2,
+	0xe1, 0xf1, 0xf2, 0x02, 0x22, 0x31, 0x40, 0x3f, 0x2e, 0x81, 0xb7, 0x82,
+	0x0c, 0xfc, 0x81, 0xc0, 0x82, 0x08, 0x19, 0x80,
+	/* Ascii 37 */
+	0x18, 0x82, 0x0e, 0x02, 0x2e, 0x20, 0x21, 0x12, 0x02, 0xe2, 0xe0, 0xef,
+	0xfe, 0x0e, 0x81, 0x82, 0x03, 0x00, 0x82, 0x15, 0x15, 0x81, 0x00, 0xef,
+	0xdf, 0xd0, 0xd1, 0xe1, 0xe0, 0xef, 0xfe, 0x0e, 0x2e, 0x20, 0x21, 0x12,
+	0x02, 0xe2, 0x80,
+	/* Ascii 38 */
+	0x00, 0x80,
+	/* Ascii 39 */
+	0x0a, 0x82, 0x05, 0x13, 0xf1, 0x11, 0x1f, 0x0e, 0xfe, 0xff, 0x80,
+	/* Ascii 40 */
+	0x0e, 0x82, 0x0b, 0x19, 0xee, 0xed, 0xec, 0xfb, 0x0c, 0x1b, 0x2c, 0x2d,
+	0x2e, 0x80,
+	/* Ascii 41 */
+	0x0e, 0x82, 0x03, 0x19, 0x2e, 0x2d, 0x2c, 0x1b, 0x0c, 0xfb, 0xec, 0xed,
+	0xee, 0x80,
+	/* Ascii 42 */
+	0x10, 0x82, 0x03, 0x0c, 0x82, 0x0d, 0x12, 0x81, 0x0a, 0x82, 0x03, 0x12,
+	0x81, 0x53, 0x82, 0x08, 0x09, 0x80,
+	/* Ascii 43 */
+	0x1a, 0x82, 0x0d, 0x12, 0x82, 0x0d, 0x00, 0x81, 0x82, 0x04, 0x09, 0x82,
+	0x16, 0x09, 0x80,
+	/* Ascii 44 */
+	0x0a, 0x61, 0xff, 0xf1, 0x11, 0x1f, 0x0e, 0xfe, 0xff, 0x80,
+	/* Ascii 45 */
+	0x1a, 0x82, 0x04, 0x09, 0x82, 0x16, 0x09, 0x80,
+	/* Ascii 46 */
+	0x0a, 0x52, 0xff, 0x1f, 0x11, 0xf1, 0x80,
+	/* Ascii 47 */
+	0x16, 0x82, 0x14, 0x19, 0x82, 0x02, 0xf9, 0x80,
+	/* Ascii 48 */
+	0x14, 0x82, 0x09, 0x15, 0xdf, 0xed, 0xfb, 0x0d, 0x1b, 0x2d, 0x3f, 0x20,
+	0x31, 0x23, 0x15, 0x03, 0xf5, 0xe3, 0xd1, 0xe0, 0x80,
+	/* Ascii 49 */
+	0x14, 0x82, 0x06, 0x11, 0x21, 0x33, 0x82, 0x0b, 0x00, 0x80,
+	/* Ascii 50 */
+	0x14, 0x82, 0x04, 0x10, 0x01, 0x12, 0x11, 0x21, 0x40, 0x2f, 0x1f, 0x1e,
+	0x0e, 0xfe, 0xed, 0x82, 0x03, 0x00, 0x82, 0x11, 0x00, 0x80,
+	/* Ascii 51 */
+	0x14, 0x82, 0x05, 0x15, 0x82, 0x10, 0x15, 0xa8, 0x30, 0x2f, 0x1f, 0x1d,
+	0x0e, 0xfd, 0xee, 0xdf, 0xd0, 0xd1, 0xf1, 0xf2, 0x80,
+	/* Ascii 52 */
+	0x14, 0x82, 0x0d, 0x00, 0x82, 0x0d, 0x15, 0x81, 0x00, 0x82, 0x03, 0x07,
+	0x82, 0x12, 0x07, 0x80,
+	/* Ascii 53 */
+	0x14, 0x82, 0x0f, 0x15, 0x82, 0x05, 0x15, 0x82, 0x04, 0x0c, 0x11, 0x31,
+	0x30, 0x3f, 0x2e, 0x1d, 0x0e, 0xfd, 0xee, 0xdf, 0xd0, 0xd1, 0xf1, 0xf2,
+	0x80,
+	/* Ascii 54 */
+	0x14, 0x82, 0x10, 0x12, 0xf2, 0xd1, 0xe0, 0xdf, 0xed, 0xfb, 0x0b, 0x1c,
+	0x2e, 0x3f, 0x10, 0x31, 0x22, 0x13, 0x01, 0xf3, 0xe2, 0xd1, 0xf0, 0xdf,
+	0xee, 0xfd, 0x80,
+	/* Ascii 55 */
+	0x14, 0x82, 0x03, 0x15, 0x82, 0x11, 0x15, 0x81, 0x00, 0x82, 0x07, 0x00,
+	0x80,
+	/* Ascii 56 */
+	0x14, 0x82, 0x08, 0x15, 0xdf, 0xfe, 0x0e, 0x1e, 0x2f, 0x4f, 0x3f, 0x2e,
+	0x1e, 0x0d, 0xfe, 0xff, 0xdf, 0xc0, 0xd1, 0xf1, 0xf2, 0x03, 0x12, 0x22,
+	0x31, 0x41, 0x21, 0x12, 0x02, 0xf2, 0xd1, 0xc0, 0x80,
+	/* Ascii 57 */
+	0x14, 0x82, 0x10, 0x0e, 0xfd, 0xee, 0xdf, 0xf0, 0xd1, 0xe2, 0xf3, 0x01,
+	0x13, 0x22, 0x31, 0x10, 0x3f, 0x2e, 0x1c, 0x0b, 0xfb, 0xed, 0xdf, 0xe0,
+	0xd1, 0xf2, 0x80,
+	/* Ascii 58 */
+	0x0a, 0x52, 0xff, 0x1f, 0x11, 0xf1, 0x81, 0x82, 0x05, 0x0c, 0x11, 0xf1,
+	0xff, 0x1f, 0x80,
+	/* Ascii 59 */
+	0x0a, 0x4c, 0x11, 0x12, 0x02, 0xf1, 0xff, 0x1f, 0x11, 0x81, 0x82, 0x05,
+	0x0c, 0x11, 0xf1, 0xff, 0x1f, 0x80,
+	/* Ascii 60 */
+	0x18, 0x82, 0x14, 0x12, 0x82, 0x04, 0x09, 0x82, 0x14, 0x00, 0x80,
+	/* Ascii 61 */
+	0x1a, 0x82, 0x16, 0x06, 0x82, 0x04, 0x06, 0x81, 0x06, 0x82, 0x16, 0x0c,
+	0x80,
+	/* Ascii 62 */
+	0x18, 0x82, 0x04, 0x12, 0x82, 0x14, 0x09, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 63 */
+	0x12, 0x82, 0x03, 0x10, 0x01, 0x12, 0x11, 0x21, 0x40, 0x2f, 0x1f, 0x1e,
+	0x0e, 0xfe, 0xff, 0xce, 0x0d, 0x81, 0x0b, 0xff, 0x1f, 0x11, 0xf1, 0x80,
+	/* Ascii 64 */
+	0x00, 0x80,
+	/* Ascii 65 */
+	0x12, 0x47, 0x82, 0x0e, 0x07, 0x81, 0x39, 0x82, 0x09, 0x15, 0x81, 0x00,
+	0x82, 0x01, 0x00, 0x80,
+	/* Ascii 66 */
+	0x15, 0x82, 0x04, 0x0b, 0x82, 0x0d, 0x0b, 0x3f, 0x1f, 0x1e, 0x0d, 0xfe,
+	0xff, 0xdf, 0x82, 0x04, 0x00, 0x81, 0x00, 0x82, 0x04, 0x15, 0x81, 0x00,
+	0x82, 0x0d, 0x15, 0x3f, 0x1f, 0x1e, 0x0e, 0xfe, 0xff, 0xdf, 0x80,
+	/* Ascii 67 */
+	0x15, 0x82, 0x12, 0x10, 0xf2, 0xe2, 0xe1, 0xc0, 0xef, 0xee, 0xfe, 0xfd,
+	0x0b, 0x1d, 0x1e, 0x2e, 0x2f, 0x40, 0x21, 0x22, 0x12, 0x80,
+	/* Ascii 68 */
+	0x15, 0x40, 0x70, 0x31, 0x22, 0x12, 0x13, 0x05, 0xf3, 0xf2, 0xe2, 0xd1,
+	0x90, 0x81, 0x00, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 69 */
+	0x13, 0x82, 0x11, 0x00, 0x82, 0x04, 0x00, 0x81, 0x00, 0x82, 0x04, 0x15,
+	0x81, 0x00, 0x82, 0x11, 0x15, 0x81, 0x82, 0x0c, 0x0b, 0x82, 0x04, 0x0b,
+	0x80,
+	/* Ascii 70 */
+	0x12, 0x82, 0x0c, 0x0b, 0x82, 0x04, 0x0b, 0x81, 0x82, 0x04, 0x00, 0x82,
+	0x04, 0x15, 0x81, 0x00, 0x82, 0x11, 0x15, 0x80,
+	/* Ascii 71 */
+	0x15, 0x82, 0x0d, 0x08, 0x50, 0x81, 0x00, 0x0d, 0xfe, 0xee, 0xef, 0xc0,
+	0xe1, 0xe2, 0xf2, 0xf3, 0x05, 0x13, 0x12, 0x22, 0x21, 0x40, 0x2f, 0x2e,
+	0x1e, 0x80,
+	/* Ascii 72 */
+	0x16, 0x82, 0x12, 0x00, 0x82, 0x12, 0x15, 0x81, 0x82, 0x12, 0x0b, 0x82,
+	0x04, 0x0b, 0x81, 0x82, 0x04, 0x15, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 73 */
+	0x08, 0x82, 0x04, 0x15, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 74 */
+	0x10, 0x82, 0x0c, 0x15, 0x82, 0x0c, 0x05, 0xfd, 0xff, 0xef, 0xe0, 0xe1,
+	0xf1, 0xf3, 0x02, 0x80,
+	/* Ascii 75 */
+	0x15, 0x82, 0x12, 0x00, 0x82, 0x09, 0x0c, 0x81, 0x82, 0x04, 0x15, 0x82,
+	0x04, 0x00, 0x81, 0x07, 0x82, 0x12, 0x15, 0x80,
+	/* Ascii 76 */
+	0x11, 0x82, 0x04, 0x15, 0x82, 0x04, 0x00, 0x81, 0x00, 0x82, 0x10, 0x00,
+	0x80,
+	/* Ascii 77 */
+	0x18, 0x82, 0x14, 0x00, 0x82, 0x14, 0x15, 0x81, 0x00, 0x82, 0x0c, 0x00,
+	0x81, 0x00, 0x82, 0x04, 0x15, 0x81, 0x00, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 78 */
+	0x16, 0x82, 0x12, 0x15, 0x82, 0x12, 0x00, 0x81, 0x00, 0x82, 0x04, 0x15,
+	0x81, 0x00, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 79 */
+	0x16, 0x82, 0x09, 0x15, 0xef, 0xee, 0xfe, 0xfd, 0x0b, 0x1d, 0x1e, 0x2e,
+	0x2f, 0x40, 0x21, 0x22, 0x12, 0x13, 0x05, 0xf3, 0xf2, 0xe2, 0xe1, 0xc0,
+	0x80,
+	/* Ascii 80 */
+	0x15, 0x82, 0x04, 0x0a, 0x82, 0x0d, 0x0a, 0x31, 0x11, 0x12, 0x03, 0xf2,
+	0xf1, 0xd1, 0x82, 0x04, 0x15, 0x81, 0x00, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 81 */
+	0x16, 0x82, 0x12, 0xfe, 0xa6, 0x81, 0x1c, 0x21, 0x22, 0x12, 0x13, 0x05,
+	0xf3, 0xf2, 0xe2, 0xe1, 0xc0, 0xef, 0xee, 0xfe, 0xfd, 0x0b, 0x1d, 0x1e,
+	0x2e, 0x2f, 0x40, 0x80,
+	/* Ascii 82 */
+	0x15, 0x82, 0x12, 0x00, 0x82, 0x0b, 0x0b, 0x81, 0x90, 0x82, 0x0d, 0x0b,
+	0x31, 0x11, 0x12, 0x02, 0xf2, 0xf1, 0xd1, 0x82, 0x04, 0x15, 0x81, 0x00,
+	0x82, 0x04, 0x00, 0x80,
+	/* Ascii 83 */
+	0x14, 0x82, 0x11, 0x12, 0xe2, 0xd1, 0xc0, 0xdf, 0xee, 0x0e, 0x1e, 0x1f,
+	0x2f, 0x6e, 0x2f, 0x1f, 0x1e, 0x0d, 0xee, 0xdf, 0xc0, 0xd1, 0xe2, 0x80,
+	/* Ascii 84 */
+	0x10, 0x82, 0x01, 0x15, 0x82, 0x0f, 0x15, 0x81, 0x90, 0x82, 0x08, 0x00,
+	0x80,
+	/* Ascii 85 */
+	0x16, 0x82, 0x04, 0x15, 0x82, 0x04, 0x06, 0x1d, 0x2e, 0x3f, 0x20, 0x31,
+	0x22, 0x13, 0x82, 0x12, 0x15, 0x80,
+	/* Ascii 86 */
+	0x12, 0x82, 0x11, 0x15, 0x82, 0x09, 0x00, 0x81, 0x00, 0x82, 0x01, 0x15,
+	0x80,
+	/* Ascii 87 */
+	0x18, 0x82, 0x16, 0x15, 0x82, 0x11, 0x00, 0x81, 0x00, 0x82, 0x0c, 0x15,
+	0x81, 0x00, 0x82, 0x07, 0x00, 0x81, 0x00, 0x82, 0x02, 0x15, 0x80,
+	/* Ascii 88 */
+	0x14, 0x30, 0x82, 0x11, 0x15, 0x81, 0x82, 0x03, 0x15, 0x82, 0x11, 0x00,
+	0x80,
+	/* Ascii 89 */
+	0x12, 0x82, 0x11, 0x15, 0x82, 0x09, 0x0b, 0x81, 0x82, 0x09, 0x00, 0x82,
+	0x09, 0x0b, 0x82, 0x01, 0x15, 0x80,
+	/* Ascii 90 */
+	0x14, 0x82, 0x11, 0x00, 0x82, 0x03, 0x00, 0x81, 0x00, 0x82, 0x11, 0x15,
+	0x81, 0x00, 0x82, 0x03, 0x15, 0x80,
+	/* Ascii 91 */
+	0x0e, 0x82, 0x0b, 0xf9, 0x90, 0x81, 0x00, 0x82, 0x04, 0x19, 0x81, 0x00,
+	0x70, 0x81, 0xa0, 0x82, 0x05, 0xf9, 0x80,
+	/* Ascii 92 */
+	0x0e, 0x82, 0x00, 0x15, 0x82, 0x0e, 0xfd, 0x80,
+	/* Ascii 93 */
+	0x0e, 0x39, 0x70, 0x81, 0x00, 0x82, 0x0a, 0x19, 0x81, 0x00, 0x90, 0x81,
+	0x60, 0x82, 0x09, 0xf9, 0x80,
+	/* Ascii 94 */
+	0x10, 0x82, 0x08, 0x00, 0x82, 0x08, 0x11, 0x81, 0x2e, 0xe3, 0xed, 0x81,
+	0xdd, 0x55, 0x5b, 0x80,
+	/* Ascii 95 */
+	0x10, 0x0e, 0x82, 0x10, 0xfe, 0x80,
+	/* Ascii 96 */
+	0x0a, 0x82, 0x06, 0x15, 0xff, 0xfe, 0x0e, 0x1f, 0x11, 0xf1, 0x80,
+	/* Ascii 97 */
+	0x13, 0x82, 0x0f, 0x03, 0xee, 0xef, 0xd0, 0xe1, 0xe2, 0xf3, 0x02, 0x13,
+	0x22, 0x21, 0x30, 0x2f, 0x2e, 0x81, 0x03, 0x82, 0x0f, 0x00, 0x80,
+	/* Ascii 98 */
+	0x13, 0x82, 0x04, 0x0b, 0x22, 0x21, 0x30, 0x2f, 0x2e, 0x1d, 0x0e, 0xfd,
+	0xee, 0xef, 0xd0, 0xe1, 0xe2, 0x81, 0x0d, 0x82, 0x04, 0x15, 0x80,
+	/* Ascii 99 */
+	0x12, 0x82, 0x0f, 0x0b, 0xe2, 0xe1, 0xd0, 0xef, 0xee, 0xfd, 0x0e, 0x1d,
+	0x2e, 0x2f, 0x30, 0x21, 0x22, 0x80,
+	/* Ascii 100 */
+	0x13, 0x82, 0x0f, 0x0b, 0xe2, 0xe1, 0xd0, 0xef, 0xee, 0xfd, 0x0e, 0x1d,
+	0x2e, 0x2f, 0x30, 0x21, 0x22, 0x81, 0x0d, 0x82, 0x0f, 0x15, 0x80,
+	/* Ascii 101 */
+	0x12, 0x82, 0x03, 0x08, 0x82, 0x0f, 0x08, 0x02, 0xf2, 0xf1, 0xe1, 0xd0,
+	0xef, 0xee, 0xfd, 0x0e, 0x1d, 0x2e, 0x2f, 0x30, 0x21, 0x22, 0x80,
+	/* Ascii 102 */
+	0x0c, 0x82, 0x02, 0x0e, 0x70, 0x81, 0x17, 0xe0, 0xef, 0xfd, 0x82, 0x05,
+	0x00, 0x80,
+	/* Ascii 103 */
+	0x13, 0x82, 0x0f, 0x03, 0xee, 0xef, 0xd0, 0xe1, 0xe2, 0xf3, 0x02, 0x13,
+	0x22, 0x21, 0x30, 0x2f, 0x2e, 0x81, 0x03, 0x82, 0x0f, 0xfe, 0xfd, 0xff,
+	0xef, 0xd0, 0xe1, 0x80,
+	/* Ascii 104 */
+	0x13, 0x82, 0x04, 0x15, 0x82, 0x04, 0x00, 0x81, 0x82, 0x04, 0x0a, 0x33,
+	0x21, 0x30, 0x2f, 0x1d, 0x82, 0x0f, 0x00, 0x80,
+	/* Ascii 105 */
+	0x08, 0x40, 0x82, 0x04, 0x0e, 0x81, 0x06, 0x11, 0xf1, 0xff, 0x1f, 0x80,
+	/* Ascii 106 */
+	0x0a, 0x19, 0x20, 0x21, 0x13, 0x82, 0x06, 0x0e, 0x81, 0x06, 0x11, 0xf1,
+	0xff, 0x1f, 0x80,
+	/* Ascii 107 */
+	0x11, 0x82, 0x0f, 0x00, 0x82, 0x08, 0x08, 0x81, 0x66, 0x82, 0x04, 0x04,
+	0x81, 0x0c, 0x82, 0x04, 0x15, 0x80,
+	/* Ascii 108 */
+	0x08, 0x82, 0x04, 0x15, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 109 */
+	0x1e, 0x82, 0x1a, 0x00, 0x82, 0x1a, 0x0a, 0xf3, 0xe1, 0xd0, 0xef, 0xdd,
+	0x81, 0x82, 0x0f, 0x00, 0x82, 0x0f, 0x0a, 0xf3, 0xe1, 0xd0, 0xef, 0xdd,
+	0x81, 0x04, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 110 */
+	0x13, 0x82, 0x0f, 0x00, 0x82, 0x0f, 0x0a, 0xf3, 0xe1, 0xd0, 0xef, 0xdd,
+	0x81, 0x04, 0x82, 0x04, 0x00, 0x80,
+	/* Ascii 111 */
+	0x13, 0x82, 0x08, 0x0e, 0xef, 0xee, 0xfd, 0x0e, 0x1d, 0x2e, 0x2f, 0x30,
+	0x21, 0x22, 0x13, 0x02, 0xf3, 0xe2, 0xe1, 0xd0, 0x80,
+	/* Ascii 112 */
+	0x13, 0x43, 0x2e, 0x2f, 0x30, 0x21, 0x22, 0x13, 0x02, 0xf3, 0xe2, 0xe1,
+	0xd0, 0xef, 0xee, 0x81, 0x03, 0x82, 0x04, 0xf9, 0x80,
+	/* Ascii 113 */
+	0x13, 0x82, 0x0f, 0x03, 0xee, 0xef, 0xd0, 0xe1, 0xe2, 0xf3, 0x02, 0x13,
+	0x22, 0x21, 0x30, 0x2f, 0x2e, 0x81, 0x03, 0x82, 0x0f, 0xf9, 0x80,
+	/* Ascii 114 */
+	0x0d, 0x82, 0x0c, 0x0e, 0xd0, 0xef, 0xee, 0xfd, 0x81, 0x06, 0x82, 0x04,
+	0x00, 0x80,
+	/* Ascii 115 */
+	0x11, 0x82, 0x0e, 0x0b, 0xf2, 0xd1, 0xd0, 0xdf, 0xfe, 0x1e, 0x2f, 0x5f,
+	0x2f, 0x1e, 0x0f, 0xfe, 0xdf, 0xd0, 0xd1, 0xf2, 0x80,
+	/* Ascii 116 */
+	0x0c, 0x82, 0x09, 0x0e, 0x90, 0x81, 0x37, 0x82, 0x05, 0x04, 0x1d, 0x2f,
+	0x20, 0x80,
+	/* Ascii 117 */
+	0x13, 0x82, 0x0f, 0x0e, 0x82, 0x0f, 0x00, 0x81, 0x04, 0xdd, 0xef, 0xd0,
+	0xe1, 0xf3, 0x82, 0x04, 0x0e, 0x80,
+	/* Ascii 118 */
+	0x10, 0x82, 0x0e, 0x0e, 0x82, 0x08, 0x00, 0x81, 0x00, 0x82, 0x02, 0x0e,
+	0x80,
+	/* Ascii 119 */
+	0x16, 0x82, 0x13, 0x0e, 0x82, 0x0f, 0x00, 0x81, 0x00, 0x82, 0x0b, 0x0e,
+	0x81, 0x00, 0x82, 0x07, 0x00, 0x81, 0x00, 0x82, 0x03, 0x0e, 0x80,
+	/* Ascii 120 */
+	0x11, 0x30, 0x82, 0x0e, 0x0e, 0x81, 0x82, 0x03, 0x0e, 0x82, 0x0e, 0x00,
+	0x80,
+	/* Ascii 121 */
+	0x10, 0x19, 0x10, 0x21, 0x22, 0x24, 0x82, 0x0e, 0x0e, 0x81, 0x82, 0x02,
+	0x0e, 0x82, 0x08, 0x00, 0x80,
+	/* Ascii 122 */
+	0x11, 0x82, 0x0e, 0x00, 0x82, 0x03, 0x00, 0x81, 0x00, 0x82, 0x0e, 0x0e,
+	0x81, 0x00, 0x82, 0x03, 0x0e, 0x80,
+	/* Ascii 123 */
+	0x00, 0x80,
+	/* Ascii 124 */
+	0x08, 0x82, 0x04, 0x19, 0x82, 0x04, 0xf9, 0x80,
+	/* Ascii 125 */
+	0x00, 0x80,
+	/* Ascii 126 */
+	0x18, 0x82, 0x15, 0x0c, 0x0e, 0xfd, 0xef, 0xe0, 0xe1, 0xc3, 0xe1, 0xe0,
+	0xef, 0xfe, 0x81, 0x0e, 0x02, 0x13, 0x21, 0x20, 0x2f, 0x4d, 0x2f, 0x20,
+	0x21, 0x12, 0x80,
+};
+
+const PROGMEM uint16_t hershey_simplex_offset[] = {
+	0, 2, 16, 27, 52, 84, 123, 125, 136, 150, 164, 182,
+	197, 207, 215, 222, 230, 251, 261, 283, 304, 320, 345, 372,
+	385, 418, 445, 460, 478, 489, 502, 513, 537, 539, 555, 590,
+	612, 631, 656, 676, 702, 724, 732, 748, 768, 781, 804, 822,
+	847, 870, 898, 926, 950, 963, 981, 994, 1017, 1030, 1048, 1066,
+	1085, 1093, 1110, 1126, 1132, 1143, 1166, 1189, 1207, 1230, 1253, 1267,
+	1295, 1315, 1327, 1342, 1360, 1368, 1398, 1416, 1437, 1458, 1481, 1495,
+	1516, 1530, 1548, 1561, 1584, 1597, 1614, 1632, 1634, 1642, 1644,
+};
+
+const PROGMEM uint8_t hershey_simplex_lod[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 32 */
+	0x8f, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, /* Ascii 33 */
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, /* Ascii 34 */
+	0xff, 0x07, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, /* Ascii 35 */
+	0x21, 0x20, 0xf9, 0x03, 0x25, 0x29, 0xf9, 0x03, /* Ascii 36 */
+	0x21, 0xfc, 0x20, 0x42, 0xa5, 0xfc, 0xa2, 0x52, /* Ascii 37 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 38 */
+	0x41, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, /* Ascii 39 */
+	0x11, 0x02, 0x00, 0x00, 0x51, 0x02, 0x00, 0x00, /* Ascii 40 */
+	0x11, 0x02, 0x00, 0x00, 0x51, 0x02, 0x00, 0x00, /* Ascii 41 */
+	0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, /* Ascii 42 */
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, /* Ascii 43 */
+	0x81, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, /* Ascii 44 */
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, /* Ascii 45 */
+	0x11, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, /* Ascii 46 */
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, /* Ascii 47 */
+	0x11, 0x11, 0x01, 0x00, 0x55, 0x55, 0x01, 0x00, /* Ascii 48 */
+	0x0d, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, /* Ascii 49 */
+	0x11, 0x31, 0x00, 0x00, 0x31, 0x39, 0x00, 0x00, /* Ascii 50 */
+	0x87, 0x44, 0x00, 0x00, 0x97, 0x54, 0x00, 0x00, /* Ascii 51 */
+	0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, /* Ascii 52 */
+	0x47, 0x04, 0x01, 0x00, 0x57, 0x25, 0x01, 0x00, /* Ascii 53 */
+	0x51, 0x11, 0x42, 0x00, 0x55, 0x55, 0x52, 0x00, /* Ascii 54 */
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, /* Ascii 55 */
+	0x11, 0x22, 0x02, 0x11, 0x95, 0xaa, 0x12, 0x15, /* Ascii 56 */
+	0x21, 0x44, 0x45, 0x00, 0xa5, 0x54, 0x55, 0x00, /* Ascii 57 */
+	0x71, 0x04, 0x00, 0x00, 0x75, 0x05, 0x00, 0x00, /* Ascii 58 */
+	0x81, 0x23, 0x00, 0x00, 0xa5, 0x2b, 0x00, 0x00, /* Ascii 59 */
+	0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, /* Ascii 60 */
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, /* Ascii 61 */
+	0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, /* Ascii 62 */
+	0x81, 0xe0, 0x08, 0x00, 0x91, 0xf2, 0x0a, 0x00, /* Ascii 63 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 64 */
+	0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, /* Ascii 65 */
+	0x91, 0x7e, 0x42, 0x00, 0x93, 0x7e, 0x4a, 0x00, /* Ascii 66 */
+	0x11, 0x11, 0x02, 0x00, 0x15, 0x53, 0x02, 0x00, /* Ascii 67 */
+	0x25, 0x7a, 0x00, 0x00, 0x65, 0x7a, 0x00, 0x00, /* Ascii 68 */
+	0xff, 0x07, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, /* Ascii 69 */
+	0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, /* Ascii 70 */
+	0x8f, 0x10, 0x21, 0x00, 0xaf, 0x32, 0x25, 0x00, /* Ascii 71 */
+	0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, /* Ascii 72 */
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, /* Ascii 73 */
+	0x45, 0x02, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, /* Ascii 74 */
+	0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, /* Ascii 75 */
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, /* Ascii 76 */
+	0xff, 0x07, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, /* Ascii 77 */
+	0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, /* Ascii 78 */
+	0x21, 0x84, 0x10, 0x00, 0x29, 0xa5, 0x14, 0x00, /* Ascii 79 */
+	0x91, 0x1e, 0x00, 0x00, 0x93, 0x1e, 0x00, 0x00, /* Ascii 80 */
+	0x0f, 0x21, 0x84, 0x00, 0x4f, 0x29, 0xa5, 0x00, /* Ascii 81 */
+	0x8f, 0xf0, 0x00, 0x00, 0x9f, 0xf4, 0x00, 0x00, /* Ascii 82 */
+	0x21, 0x20, 0x09, 0x00, 0x25, 0x69, 0x09, 0x00, /* Ascii 83 */
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, /* Ascii 84 */
+	0x93, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00, /* Ascii 85 */
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, /* Ascii 86 */
+	0xff, 0x07, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, /* Ascii 87 */
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, /* Ascii 88 */
+	0x2f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, /* Ascii 89 */
+	0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, /* Ascii 90 */
+	0xff, 0x07, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, /* Ascii 91 */
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, /* Ascii 92 */
+	0xff, 0x07, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, /* Ascii 93 */
+	0xef, 0x03, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, /* Ascii 94 */
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, /* Ascii 95 */
+	0x41, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, /* Ascii 96 */
+	0x49, 0xe4, 0x01, 0x00, 0x49, 0xe5, 0x01, 0x00, /* Ascii 97 */
+	0x49, 0xe4, 0x01, 0x00, 0x49, 0xe5, 0x01, 0x00, /* Ascii 98 */
+	0x49, 0x24, 0x00, 0x00, 0x49, 0x25, 0x00, 0x00, /* Ascii 99 */
+	0x49, 0xe4, 0x01, 0x00, 0x49, 0xe5, 0x01, 0x00, /* Ascii 100 */
+	0x23, 0x09, 0x01, 0x00, 0x23, 0x29, 0x01, 0x00, /* Ascii 101 */
+	0x8f, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, /* Ascii 102 */
+	0x49, 0xe4, 0x22, 0x00, 0x49, 0xe5, 0x2a, 0x00, /* Ascii 103 */
+	0x8f, 0x02, 0x00, 0x00, 0xaf, 0x02, 0x00, 0x00, /* Ascii 104 */
+	0x8f, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, /* Ascii 105 */
+	0x71, 0x04, 0x00, 0x00, 0x7d, 0x05, 0x00, 0x00, /* Ascii 106 */
+	0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, /* Ascii 107 */
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, /* Ascii 108 */
+	0xc5, 0xc5, 0x03, 0x00, 0xd5, 0xd5, 0x03, 0x00, /* Ascii 109 */
+	0xc5, 0x03, 0x00, 0x00, 0xd5, 0x03, 0x00, 0x00, /* Ascii 110 */
+	0x11, 0x11, 0x01, 0x00, 0x55, 0x55, 0x01, 0x00, /* Ascii 111 */
+	0x49, 0xe4, 0x01, 0x00, 0x49, 0xe5, 0x01, 0x00, /* Ascii 112 */
+	0x49, 0xe4, 0x01, 0x00, 0x49, 0xe5, 0x01, 0x00, /* Ascii 113 */
+	0xf1, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, /* Ascii 114 */
+	0x11, 0x08, 0x01, 0x00, 0x55, 0x2a, 0x01, 0x00, /* Ascii 115 */
+	0x8f, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, /* Ascii 116 */
+	0x8f, 0x02, 0x00, 0x00, 0xaf, 0x02, 0x00, 0x00, /* Ascii 117 */
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, /* Ascii 118 */
+	0xff, 0x07, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, /* Ascii 119 */
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, /* Ascii 120 */
+	0xe1, 0x01, 0x00, 0x00, 0xe9, 0x01, 0x00, 0x00, /* Ascii 121 */
+	0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, /* Ascii 122 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 123 */
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, /* Ascii 124 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* Ascii 125 */
+	0x09, 0x9c, 0x40, 0x00, 0x89, 0x9c, 0x48, 0x00, /* Ascii 126 */
+};
+
+const PROGMEM glyph_bbox_t hershey_simplex_bbox[] = {
+	{   0,   0,  -1,  -1, }, /* Ascii 32 */
+	{   4,   0,   6,  21, }, /* Ascii 33 */
+	{   4,  14,  12,  21, }, /* Ascii 34 */
+	{   3,  -7,  18,  25, }, /* Ascii 35 */
+	{   3,  -4,  17,  25, }, /* Ascii 36 */
+	{   3,   0,  21,  21, }, /* Ascii 37 */
+	{   0,   0,  -1,  -1, }, /* Ascii 38 */
+	{   4,  15,   6,  21, }, /* Ascii 39 */
+	{   4,  -7,  11,  25, }, /* Ascii 40 */
+	{   3,  -7,  10,  25, }, /* Ascii 41 */
+	{   3,   9,  13,  21, }, /* Ascii 42 */
+	{   4,   0,  22,  18, }, /* Ascii 43 */
+	{   4,  -4,   6,   2, }, /* Ascii 44 */
+	{   4,   9,  22,   9, }, /* Ascii 45 */
+	{   4,   0,   6,   2, }, /* Ascii 46 */
+	{   2,  -7,  20,  25, }, /* Ascii 47 */
+	{   3,   0,  17,  21, }, /* Ascii 48 */
+	{   6,   0,  11,  21, }, /* Ascii 49 */
+	{   3,   0,  17,  21, }, /* Ascii 50 */
+	{   3,   0,  17,  21, }, /* Ascii 51 */
+	{   3,   0,  18,  21, }, /* Ascii 52 */
+	{   3,   0,  17,  21, }, /* Ascii 53 */
+	{   4,   0,  17,  21, }, /* Ascii 54 */
+	{   3,   0,  17,  21, }, /* Ascii 55 */
+	{   3,   0,  17,  21, }, /* Ascii 56 */
+	{   3,   0,  16,  21, }, /* Ascii 57 */
+	{   4,   0,   6,  14, }, /* Ascii 58 */
+	{   4,  -4,   6,  14, }, /* Ascii 59 */
+	{   4,   0,  20,  18, }, /* Ascii 60 */
+	{   4,   6,  22,  12, }, /* Ascii 61 */
+	{   4,   0,  20,  18, }, /* Ascii 62 */
+	{   3,   0,  15,  21, }, /* Ascii 63 */
+	{   0,   0,  -1,  -1, }, /* Ascii 64 */
+	{   1,   0,  17,  21, }, /* Ascii 65 */
+	{   4,   0,  18,  21, }, /* Ascii 66 */
+	{   3,   0,  18,  21, }, /* Ascii 67 */
+	{   4,   0,  18,  21, }, /* Ascii 68 */
+	{   4,   0,  17,  21, }, /* Ascii 69 */
+	{   4,   0,  17,  21, }, /* Ascii 70 */
+	{   3,   0,  18,  21, }, /* Ascii 71 */
+	{   4,   0,  18,  21, }, /* Ascii 72 */
+	{   4,   0,   4,  21, }, /* Ascii 73 */
+	{   2,   0,  12,  21, }, /* Ascii 74 */
+	{   4,   0,  18,  21, }, /* Ascii 75 */
+	{   4,   0,  16,  21, }, /* Ascii 76 */
+	{   4,   0,  20,  21, }, /* Ascii 77 */
+	{   4,   0,  18,  21, }, /* Ascii 78 */
+	{   3,   0,  19,  21, }, /* Ascii 79 */
+	{   4,   0,  18,  21, }, /* Ascii 80 */
+	{   3,  -2,  19,  21, }, /* Ascii 81 */
+	{   4,   0,  18,  21, }, /* Ascii 82 */
+	{   3,   0,  17,  21, }, /* Ascii 83 */
+	{   1,   0,  15,  21, }, /* Ascii 84 */
+	{   4,   0,  18,  21, }, /* Ascii 85 */
+	{   1,   0,  17,  21, }, /* Ascii 86 */
+	{   2,   0,  22,  21, }, /* Ascii 87 */
+	{   3,   0,  17,  21, }, /* Ascii 88 */
+	{   1,   0,  17,  21, }, /* Ascii 89 */
+	{   3,   0,  17,  21, }, /* Ascii 90 */
+	{   4,  -7,  11,  25, }, /* Ascii 91 */
+	{   0,  -3,  14,  21, }, /* Ascii 92 */
+	{   3,  -7,  10,  25, }, /* Ascii 93 */
+	{   3,   0,  13,  18, }, /* Ascii 94 */
+	{   0,  -2,  16,  -2, }, /* Ascii 95 */
+	{   4,  15,   6,  21, }, /* Ascii 96 */
+	{   3,   0,  15,  14, }, /* Ascii 97 */
+	{   4,   0,  16,  21, }, /* Ascii 98 */
+	{   3,   0,  15,  14, }, /* Ascii 99 */
+	{   3,   0,  15,  21, }, /* Ascii 100 */
+	{   3,   0,  15,  14, }, /* Ascii 101 */
+	{   2,   0,  10,  21, }, /* Ascii 102 */
+	{   3,  -7,  15,  14, }, /* Ascii 103 */
+	{   4,   0,  15,  21, }, /* Ascii 104 */
+	{   3,   0,   5,  22, }, /* Ascii 105 */
+	{   1,  -7,   7,  22, }, /* Ascii 106 */
+	{   4,   0,  15,  21, }, /* Ascii 107 */
+	{   4,   0,   4,  21, }, /* Ascii 108 */
+	{   4,   0,  26,  14, }, /* Ascii 109 */
+	{   4,   0,  15,  14, }, /* Ascii 110 */
+	{   3,   0,  16,  14, }, /* Ascii 111 */
+	{   4,  -7,  16,  14, }, /* Ascii 112 */
+	{   3,  -7,  15,  14, }, /* Ascii 113 */
+	{   4,   0,  12,  14, }, /* Ascii 114 */
+	{   3,   0,  14,  14, }, /* Ascii 115 */
+	{   2,   0,  10,  21, }, /* Ascii 116 */
+	{   4,   0,  15,  14, }, /* Ascii 117 */
+	{   2,   0,  14,  14, }, /* Ascii 118 */
+	{   3,   0,  19,  14, }, /* Ascii 119 */
+	{   3,   0,  14,  14, }, /* Ascii 120 */
+	{   1,  -7,  14,  14, }, /* Ascii 121 */
+	{   3,   0,  14,  14, }, /* Ascii 122 */
+	{   0,   0,  -1,  -1, }, /* Ascii 123 */
+	{   4,  -7,   4,  25, }, /* Ascii 124 */
+	{   0,   0,  -1,  -1, }, /* Ascii 125 */
+	{   3,   6,  21,  12, }, /* Ascii 126 */
+};
+
+const PROGMEM hershey_font_t hershey_simplex_font = {
+	hershey_simplex_data,
+	hershey_simplex_offset,
+	hershey_simplex_lod,
+	4,
+	hershey_simplex_bbox,
+};
@@ -3,449 +3,446 @@
  *
  * http://paulbourke.net/dataformats/hershey/
  *
- * A few characters are simplified
+ * A few characters are simplified.
+ *
+ * Generated by "./fontgen optimize": the stroke order and direction
+ * of each glyph minimizes the pen-up travel.  Do not edit by hand;
+ * edit the source glyphs and rerun the tool.
+ *
+ * This is the source table for fontgen; the firmware links the
+ * compressed version in hershey-simplex.c.
  */
-#include <avr/io.h>
-#include <avr/pgmspace.h>
 #include <stdint.h>
+#include "memspaces.h"
 #include "hershey.h"
 
 const PROGMEM hershey_char_t hershey_simplex[] = {
-	 { 
-	    0,16, /* Ascii 32 */
+	{
+		 0,16, /* Ascii 32 */
 	},
-    	 {
-		8,10, /* Ascii 33 */
-	    { 5,21, 5, 7,-1,-1, 5, 2, 4, 1, 5, 0, 6, 1, 5, 2, },
+	{
+		 8,10, /* Ascii 33 */
+		{  5,21,  5, 7, -1,-1,  5, 2,  4, 1,  5, 0,  6, 1,  5, 2, },
 	},
-	 {
-	    5,16, /* Ascii 34 */
-	    { 4,21, 4,14, -1,-1, 12,21, 12,14, },
+	{
+		 5,16, /* Ascii 34 */
+		{ 12,14, 12,21, -1,-1,  4,21,  4,14, },
 	},
-	 {
-	   11,21, /* Ascii 35 */
-	   11,25, 4,-7, -1,-1, 17,25, 10,-7, -1,-1, 4,12, 18,12, -1,-1, 3, 6, 17, 6,
+	{
+		11,21, /* Ascii 35 */
+		{ 17, 6,  3, 6, -1,-1,  4,12, 18,12, -1,-1, 17,25, 10,-7, -1,-1,  4,-7,
+		  11,25, },
 	},
-	 {
-	   26,20, /* Ascii 36 */
-	    8,25, 8,-4,-1,-1,12,25,12,-4,-1,-1,17,18,15,20,12,21, 8,21, 5,20, 3,
-	   18, 3,16, 4,14, 5,13, 7,12,13,10,15, 9,16, 8,17, 6,17, 3,15, 1,12, 0,
-	    8, 0, 5, 1, 3, 3,
+	{
+		26,20, /* Ascii 36 */
+		{  3, 3,  5, 1,  8, 0, 12, 0, 15, 1, 17, 3, 17, 6, 16, 8, 15, 9, 13,10,
+		   7,12,  5,13,  4,14,  3,16,  3,18,  5,20,  8,21, 12,21, 15,20, 17,18,
+		  -1,-1, 12,25, 12,-4, -1,-1,  8,-4,  8,25, },
 	},
-   	{
-	   31,24, /* Ascii 37 */
-	   { 21,21, 3, 0,-1,-1, 8,21,10,19,10,17, 9,15, 7,14, 5,14, 3,16, 3,18, 4,
-	   20, 6,21, 8,21,10,20,13,19,16,19,19,20,21,21,-1,-1,17, 7,15, 6,14, 4,
-	   14, 2,16, 0,18, 0,20, 1,21, 3,21, 5,19, 7,17, 7, },
+	{
+		31,24, /* Ascii 37 */
+		{ 14, 2, 16, 0, 18, 0, 20, 1, 21, 3, 21, 5, 19, 7, 17, 7, 15, 6, 14, 4,
+		  14, 2, -1,-1,  3, 0, 21,21, -1,-1, 21,21, 19,20, 16,19, 13,19, 10,20,
+		   8,21,  6,21,  4,20,  3,18,  3,16,  5,14,  7,14,  9,15, 10,17, 10,19,
+		   8,21, },
 	},
 	{
-#if 0
-   34,26, /* Ascii 38 */
-   23,12,23,13,22,14,21,14,20,13,19,11,17, 6,15, 3,13, 1,11, 0, 7, 0, 5,
-    1, 4, 2, 3, 4, 3, 6, 4, 8, 5, 9,12,13,13,14,14,16,14,18,13,20,11,21,
-    9,20, 8,18, 8,16, 9,13,11,10,16, 3,18, 1,20, 0,22, 0,23, 1,23, 2,-1,
-#endif
+		 0, 0, /* Ascii 38 */
 	},
 	{
-    7,10, /* Ascii 39 */
-    { 5,19, 4,20, 5,21, 6,20, 6,18, 5,16, 4,15, },
+		 7,10, /* Ascii 39 */
+		{  5,19,  4,20,  5,21,  6,20,  6,18,  5,16,  4,15, },
 	},
 	{
-   10,14, /* Ascii 40 */
-   { 11,25, 9,23, 7,20, 5,16, 4,11, 4, 7, 5, 2, 7,-2, 9,-5,11,-7, },
+		10,14, /* Ascii 40 */
+		{ 11,25,  9,23,  7,20,  5,16,  4,11,  4, 7,  5, 2,  7,-2,  9,-5, 11,-7, },
 	},
 	{
-   10,14, /* Ascii 41 */
-    3,25, 5,23, 7,20, 9,16,10,11,10, 7, 9, 2, 7,-2, 5,-5, 3,-7,-1,-1,-1,
+		10,14, /* Ascii 41 */
+		{  3,25,  5,23,  7,20,  9,16, 10,11, 10, 7,  9, 2,  7,-2,  5,-5,  3,-7, },
 	},
 	{
-    8,16, /* Ascii 42 */
-    8,21, 8, 9,-1,-1, 3,18,13,12,-1,-1,13,18, 3,12,-1,-1,-1,-1,-1,-1,-1,
+		 8,16, /* Ascii 42 */
+		{  3,12, 13,18, -1,-1, 13,12,  3,18, -1,-1,  8,21,  8, 9, },
 	},
 	{
-    5,26, /* Ascii 43 */
-   13,18,13, 0,-1,-1, 4, 9,22, 9,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		 5,26, /* Ascii 43 */
+		{ 13,18, 13, 0, -1,-1,  4, 9, 22, 9, },
 	},
 	{
-    8,10, /* Ascii 44 */
-    6, 1, 5, 0, 4, 1, 5, 2, 6, 1, 6,-1, 5,-3, 4,-4,-1,-1,-1,-1,-1,-1,-1,
+		 8,10, /* Ascii 44 */
+		{  6, 1,  5, 0,  4, 1,  5, 2,  6, 1,  6,-1,  5,-3,  4,-4, },
 	},
 	{
-    2,26, /* Ascii 45 */
-    4, 9,22, 9,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		 2,26, /* Ascii 45 */
+		{  4, 9, 22, 9, },
 	},
 	{
-    5,10, /* Ascii 46 */
-    5, 2, 4, 1, 5, 0, 6, 1, 5, 2,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		 5,10, /* Ascii 46 */
+		{  5, 2,  4, 1,  5, 0,  6, 1,  5, 2, },
 	},
 	{
-    2,22, /* Ascii 47 */
-   20,25, 2,-7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		 2,22, /* Ascii 47 */
+		{ 20,25,  2,-7, },
 	},
 	{
-   17,20, /* Ascii 48 */
-    9,21, 6,20, 4,17, 3,12, 3, 9, 4, 4, 6, 1, 9, 0,11, 0,14, 1,16, 4,17,
-    9,17,12,16,17,14,20,11,21, 9,21,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		17,20, /* Ascii 48 */
+		{  9,21,  6,20,  4,17,  3,12,  3, 9,  4, 4,  6, 1,  9, 0, 11, 0, 14, 1,
+		  16, 4, 17, 9, 17,12, 16,17, 14,20, 11,21,  9,21, },
 	},
 	{
-    4,20, /* Ascii 49 */
-    6,17, 8,18,11,21,11, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		 4,20, /* Ascii 49 */
+		{  6,17,  8,18, 11,21, 11, 0, },
 	},
 	{
-   14,20, /* Ascii 50 */
-    4,16, 4,17, 5,19, 6,20, 8,21,12,21,14,20,15,19,16,17,16,15,15,13,13,
-   10, 3, 0,17, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		14,20, /* Ascii 50 */
+		{  4,16,  4,17,  5,19,  6,20,  8,21, 12,21, 14,20, 15,19, 16,17, 16,15,
+		  15,13, 13,10,  3, 0, 17, 0, },
 	},
 	{
-   15,20, /* Ascii 51 */
-    5,21,16,21,10,13,13,13,15,12,16,11,17, 8,17, 6,16, 3,14, 1,11, 0, 8,
-    0, 5, 1, 4, 2, 3, 4,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		15,20, /* Ascii 51 */
+		{  5,21, 16,21, 10,13, 13,13, 15,12, 16,11, 17, 8, 17, 6, 16, 3, 14, 1,
+		  11, 0,  8, 0,  5, 1,  4, 2,  3, 4, },
 	},
 	{
-    6,20, /* Ascii 52 */
-   13,21, 3, 7,18, 7,-1,-1,13,21,13, 0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		 6,20, /* Ascii 52 */
+		{ 13, 0, 13,21, -1,-1, 13,21,  3, 7, 18, 7, },
 	},
 	{
-   17,20, /* Ascii 53 */
-   15,21, 5,21, 4,12, 5,13, 8,14,11,14,14,13,16,11,17, 8,17, 6,16, 3,14,
-    1,11, 0, 8, 0, 5, 1, 4, 2, 3, 4,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		17,20, /* Ascii 53 */
+		{ 15,21,  5,21,  4,12,  5,13,  8,14, 11,14, 14,13, 16,11, 17, 8, 17, 6,
+		  16, 3, 14, 1, 11, 0,  8, 0,  5, 1,  4, 2,  3, 4, },
 	},
 	{
-   23,20, /* Ascii 54 */
-   16,18,15,20,12,21,10,21, 7,20, 5,17, 4,12, 4, 7, 5, 3, 7, 1,10, 0,11,
-    0,14, 1,16, 3,17, 6,17, 7,16,10,14,12,11,13,10,13, 7,12, 5,10, 4, 7,
+		23,20, /* Ascii 54 */
+		{ 16,18, 15,20, 12,21, 10,21,  7,20,  5,17,  4,12,  4, 7,  5, 3,  7, 1,
+		  10, 0, 11, 0, 14, 1, 16, 3, 17, 6, 17, 7, 16,10, 14,12, 11,13, 10,13,
+		   7,12,  5,10,  4, 7, },
 	},
 	{
-    5,20, /* Ascii 55 */
-   17,21, 7, 0,-1,-1, 3,21,17,21,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+		 5,20, /* Ascii 55 */
+		{  3,21, 17,21, -1,-1, 17,21,  7, 0, },
 	},
 	{
-   29,20, /* Ascii 56 */
-    8,21, 5,20, 4,18, 4,16, 5,14, 7,13,11,12,14,11,16, 9,17, 7,17, 4,16,
-    2,15, 1,12, 0, 8, 0, 5, 1, 4, 2, 3, 4, 3, 7, 4, 9, 6,11, 9,12,13,13,
-   15,14,16,16,16,18,15,20,12,21, 8,21,
+		29,20, /* Ascii 56 */
+		{  8,21,  5,20,  4,18,  4,16,  5,14,  7,13, 11,12, 14,11, 16, 9, 17, 7,
+		  17, 4, 16, 2, 15, 1, 12, 0,  8, 0,  5, 1,  4, 2,  3, 4,  3, 7,  4, 9,
+		   6,11,  9,12, 13,13, 15,14, 16,16, 16,18, 15,20, 12,21,  8,21, },
 	},
 	{
-   23,20, /* Ascii 57 */
-   16,14,15,11,13, 9,10, 8, 9, 8, 6, 9, 4,11, 3,14, 3,15, 4,18, 6,20, 9,
-   21,10,21,13,20,15,18,16,14,16, 9,15, 4,13, 1,10, 0, 8, 0, 5, 1, 4, 3,
+		23,20, /* Ascii 57 */
+		{ 16,14, 15,11, 13, 9, 10, 8,  9, 8,  6, 9,  4,11,  3,14,  3,15,  4,18,
+		   6,20,  9,21, 10,21, 13,20, 15,18, 16,14, 16, 9, 15, 4, 13, 1, 10, 0,
+		   8, 0,  5, 1,  4, 3, },
 	},
 	{
-   11,10, /* Ascii 58 */
-    5,14, 4,13, 5,12, 6,13, 5,14,-1,-1, 5, 2, 4, 1, 5, 0, 6, 1, 5, 2,
+		11,10, /* Ascii 58 */
+		{  5, 2,  4, 1,  5, 0,  6, 1,  5, 2, -1,-1,  5,12,  6,13,  5,14,  4,13,
+		   5,12, },
 	},
 	{
-   14,10, /* Ascii 59 */
-    5,14, 4,13, 5,12, 6,13, 5,14,-1,-1, 6, 1, 5, 0, 4, 1, 5, 2, 6, 1, 6,
-   -1, 5,-3, 4,-4,
+		14,10, /* Ascii 59 */
+		{  4,-4,  5,-3,  6,-1,  6, 1,  5, 2,  4, 1,  5, 0,  6, 1, -1,-1,  5,12,
+		   6,13,  5,14,  4,13,  5,12, },
 	},
 	{
-    3,24, /* Ascii 60 */
-   20,18, 4, 9,20, 0,
+		 3,24, /* Ascii 60 */
+		{ 20,18,  4, 9, 20, 0, },
 	},
 	{
-    5,26, /* Ascii 61 */
-    4,12,22,12,-1,-1, 4, 6,22, 6,
+		 5,26, /* Ascii 61 */
+		{ 22, 6,  4, 6, -1,-1,  4,12, 22,12, },
 	},
 	{
-    3,24, /* Ascii 62 */
-    4,18,20, 9, 4, 0,
+		 3,24, /* Ascii 62 */
+		{  4,18, 20, 9,  4, 0, },
 	},
 	{
-   20,18, /* Ascii 63 */
-    3,16, 3,17, 4,19, 5,20, 7,21,11,21,13,20,14,19,15,17,15,15,14,13,13,
-   12, 9,10, 9, 7,-1,-1, 9, 2, 8, 1, 9, 0,10, 1, 9, 2,
+		20,18, /* Ascii 63 */
+		{  3,16,  3,17,  4,19,  5,20,  7,21, 11,21, 13,20, 14,19, 15,17, 15,15,
+		  14,13, 13,12,  9,10,  9, 7, -1,-1,  9, 2,  8, 1,  9, 0, 10, 1,  9, 2, },
 	},
 	{
-#if 0
-   55,27, /* Ascii 64 */
-   18,13,17,15,15,16,12,16,10,15, 9,14, 8,11, 8, 8, 9, 6,11, 5,14, 5,16,
-    6,17, 8,-1,-1,12,16,10,14, 9,11, 9, 8,10, 6,11, 5,-1,-1,18,16,17, 8,
-   17, 6,19, 5,21, 5,23, 7,24,10,24,12,23,15,22,17,20,19,18,20,15,21,12,
-   21, 9,20, 7,19, 5,17, 4,15, 3,12, 3, 9, 4, 6, 5, 4, 7, 2, 9, 1,12, 0,
-   15, 0,18, 1,20, 2,21, 3,-1,-1,19,16,18, 8,18, 6,19, 5,
-#endif
+		 0, 0, /* Ascii 64 */
 	},
 	{
-    8,18, /* Ascii 65 */
-    9,21, 1, 0,-1,-1, 9,21,17, 0,-1,-1, 4, 7,14, 7,
+		 8,18, /* Ascii 65 */
+		{  4, 7, 14, 7, -1,-1, 17, 0,  9,21, -1,-1,  9,21,  1, 0, },
 	},
 	{
-   23,21, /* Ascii 66 */
-    4,21, 4, 0,-1,-1, 4,21,13,21,16,20,17,19,18,17,18,15,17,13,16,12,13,
-   11,-1,-1, 4,11,13,11,16,10,17, 9,18, 7,18, 4,17, 2,16, 1,13, 0, 4, 0,
+		23,21, /* Ascii 66 */
+		{  4,11, 13,11, 16,10, 17, 9, 18, 7, 18, 4, 17, 2, 16, 1, 13, 0,  4, 0,
+		  -1,-1,  4, 0,  4,21, -1,-1,  4,21, 13,21, 16,20, 17,19, 18,17, 18,15,
+		  17,13, 16,12, 13,11, },
 	},
 	{
-   18,21, /* Ascii 67 */
-   18,16,17,18,15,20,13,21, 9,21, 7,20, 5,18, 4,16, 3,13, 3, 8, 4, 5, 5,
-    3, 7, 1, 9, 0,13, 0,15, 1,17, 3,18, 5,
+		18,21, /* Ascii 67 */
+		{ 18,16, 17,18, 15,20, 13,21,  9,21,  7,20,  5,18,  4,16,  3,13,  3, 8,
+		   4, 5,  5, 3,  7, 1,  9, 0, 13, 0, 15, 1, 17, 3, 18, 5, },
 	},
 	{
-   15,21, /* Ascii 68 */
-    4,21, 4, 0,-1,-1, 4,21,11,21,14,20,16,18,17,16,18,13,18, 8,17, 5,16,
-    3,14, 1,11, 0, 4, 0,
+		15,21, /* Ascii 68 */
+		{  4, 0, 11, 0, 14, 1, 16, 3, 17, 5, 18, 8, 18,13, 17,16, 16,18, 14,20,
+		  11,21,  4,21, -1,-1,  4,21,  4, 0, },
 	},
 	{
-   11,19, /* Ascii 69 */
-    4,21, 4, 0,-1,-1, 4,21,17,21,-1,-1, 4,11,12,11,-1,-1, 4, 0,17, 0,
+		11,19, /* Ascii 69 */
+		{ 17, 0,  4, 0, -1,-1,  4, 0,  4,21, -1,-1,  4,21, 17,21, -1,-1, 12,11,
+		   4,11, },
 	},
 	{
-    8,18, /* Ascii 70 */
-    4,21, 4, 0,-1,-1, 4,21,17,21,-1,-1, 4,11,12,11,
+		 8,18, /* Ascii 70 */
+		{ 12,11,  4,11, -1,-1,  4, 0,  4,21, -1,-1,  4,21, 17,21, },
 	},
 	{
-   22,21, /* Ascii 71 */
-   18,16,17,18,15,20,13,21, 9,21, 7,20, 5,18, 4,16, 3,13, 3, 8, 4, 5, 5,
-    3, 7, 1, 9, 0,13, 0,15, 1,17, 3,18, 5,18, 8,-1,-1,13, 8,18, 8,
+		22,21, /* Ascii 71 */
+		{ 13, 8, 18, 8, -1,-1, 18, 8, 18, 5, 17, 3, 15, 1, 13, 0,  9, 0,  7, 1,
+		   5, 3,  4, 5,  3, 8,  3,13,  4,16,  5,18,  7,20,  9,21, 13,21, 15,20,
+		  17,18, 18,16, },
 	},
 	{
-    8,22, /* Ascii 72 */
-    4,21, 4, 0,-1,-1,18,21,18, 0,-1,-1, 4,11,18,11,
+		 8,22, /* Ascii 72 */
+		{ 18, 0, 18,21, -1,-1, 18,11,  4,11, -1,-1,  4,21,  4, 0, },
 	},
 	{
-    2, 8, /* Ascii 73 */
-    4,21, 4, 0,
+		 2, 8, /* Ascii 73 */
+		{  4,21,  4, 0, },
 	},
 	{
-   10,16, /* Ascii 74 */
-   12,21,12, 5,11, 2,10, 1, 8, 0, 6, 0, 4, 1, 3, 2, 2, 5, 2, 7,
+		10,16, /* Ascii 74 */
+		{ 12,21, 12, 5, 11, 2, 10, 1,  8, 0,  6, 0,  4, 1,  3, 2,  2, 5,  2, 7, },
 	},
 	{
-    8,21, /* Ascii 75 */
-    4,21, 4, 0,-1,-1,18,21, 4, 7,-1,-1, 9,12,18, 0,
+		 8,21, /* Ascii 75 */
+		{ 18, 0,  9,12, -1,-1,  4,21,  4, 0, -1,-1,  4, 7, 18,21, },
 	},
 	{
-    5,17, /* Ascii 76 */
-    4,21, 4, 0,-1,-1, 4, 0,16, 0,
+		 5,17, /* Ascii 76 */
+		{  4,21,  4, 0, -1,-1,  4, 0, 16, 0, },
 	},
 	{
-   11,24, /* Ascii 77 */
-    4,21, 4, 0,-1,-1, 4,21,12, 0,-1,-1,20,21,12, 0,-1,-1,20,21,20, 0,
+		11,24, /* Ascii 77 */
+		{ 20, 0, 20,21, -1,-1, 20,21, 12, 0, -1,-1, 12, 0,  4,21, -1,-1,  4,21,
+		   4, 0, },
 	},
 	{
-    8,22, /* Ascii 78 */
-    4,21, 4, 0,-1,-1, 4,21,18, 0,-1,-1,18,21,18, 0,
+		 8,22, /* Ascii 78 */
+		{ 18,21, 18, 0, -1,-1, 18, 0,  4,21, -1,-1,  4,21,  4, 0, },
 	},
 	{
-   21,22, /* Ascii 79 */
-    9,21, 7,20, 5,18, 4,16, 3,13, 3, 8, 4, 5, 5, 3, 7, 1, 9, 0,13, 0,15,
-    1,17, 3,18, 5,19, 8,19,13,18,16,17,18,15,20,13,21, 9,21,
+		21,22, /* Ascii 79 */
+		{  9,21,  7,20,  5,18,  4,16,  3,13,  3, 8,  4, 5,  5, 3,  7, 1,  9, 0,
+		  13, 0, 15, 1, 17, 3, 18, 5, 19, 8, 19,13, 18,16, 17,18, 15,20, 13,21,
+		   9,21, },
 	},
 	{
-   13,21, /* Ascii 80 */
-    4,21, 4, 0,-1,-1, 4,21,13,21,16,20,17,19,18,17,18,14,17,12,16,11,13,
-   10, 4,10,
+		13,21, /* Ascii 80 */
+		{  4,10, 13,10, 16,11, 17,12, 18,14, 18,17, 17,19, 16,20, 13,21,  4,21,
+		  -1,-1,  4,21,  4, 0, },
 	},
 	{
-   24,22, /* Ascii 81 */
-    9,21, 7,20, 5,18, 4,16, 3,13, 3, 8, 4, 5, 5, 3, 7, 1, 9, 0,13, 0,15,
-    1,17, 3,18, 5,19, 8,19,13,18,16,17,18,15,20,13,21, 9,21,-1,-1,12, 4,
-   18,-2,
+		24,22, /* Ascii 81 */
+		{ 18,-2, 12, 4, -1,-1, 13, 0, 15, 1, 17, 3, 18, 5, 19, 8, 19,13, 18,16,
+		  17,18, 15,20, 13,21,  9,21,  7,20,  5,18,  4,16,  3,13,  3, 8,  4, 5,
+		   5, 3,  7, 1,  9, 0, 13, 0, },
 	},
 	{
-   16,21, /* Ascii 82 */
-    4,21, 4, 0,-1,-1, 4,21,13,21,16,20,17,19,18,17,18,15,17,13,16,12,13,
-   11, 4,11,-1,-1,11,11,18, 0,
+		16,21, /* Ascii 82 */
+		{ 18, 0, 11,11, -1,-1,  4,11, 13,11, 16,12, 17,13, 18,15, 18,17, 17,19,
+		  16,20, 13,21,  4,21, -1,-1,  4,21,  4, 0, },
 	},
 	{
-   20,20, /* Ascii 83 */
-   17,18,15,20,12,21, 8,21, 5,20, 3,18, 3,16, 4,14, 5,13, 7,12,13,10,15,
-    9,16, 8,17, 6,17, 3,15, 1,12, 0, 8, 0, 5, 1, 3, 3,
+		20,20, /* Ascii 83 */
+		{ 17,18, 15,20, 12,21,  8,21,  5,20,  3,18,  3,16,  4,14,  5,13,  7,12,
+		  13,10, 15, 9, 16, 8, 17, 6, 17, 3, 15, 1, 12, 0,  8, 0,  5, 1,  3, 3, },
 	},
 	{
-    5,16, /* Ascii 84 */
-    8,21, 8, 0,-1,-1, 1,21,15,21,
+		 5,16, /* Ascii 84 */
+		{  1,21, 15,21, -1,-1,  8,21,  8, 0, },
 	},
 	{
-   10,22, /* Ascii 85 */
-    4,21, 4, 6, 5, 3, 7, 1,10, 0,12, 0,15, 1,17, 3,18, 6,18,21,
+		10,22, /* Ascii 85 */
+		{  4,21,  4, 6,  5, 3,  7, 1, 10, 0, 12, 0, 15, 1, 17, 3, 18, 6, 18,21, },
 	},
 	{
-    5,18, /* Ascii 86 */
-    1,21, 9, 0,-1,-1,17,21, 9, 0,
+		 5,18, /* Ascii 86 */
+		{ 17,21,  9, 0, -1,-1,  9, 0,  1,21, },
 	},
 	{
-   11,24, /* Ascii 87 */
-    2,21, 7, 0,-1,-1,12,21, 7, 0,-1,-1,12,21,17, 0,-1,-1,22,21,17, 0,
+		11,24, /* Ascii 87 */
+		{ 22,21, 17, 0, -1,-1, 17, 0, 12,21, -1,-1, 12,21,  7, 0, -1,-1,  7, 0,
+		   2,21, },
 	},
 	{
-    5,20, /* Ascii 88 */
-    3,21,17, 0,-1,-1,17,21, 3, 0,
+		 5,20, /* Ascii 88 */
+		{  3, 0, 17,21, -1,-1,  3,21, 17, 0, },
 	},
 	{
-    6,18, /* Ascii 89 */
-    1,21, 9,11, 9, 0,-1,-1,17,21, 9,11,
+		 6,18, /* Ascii 89 */
+		{ 17,21,  9,11, -1,-1,  9, 0,  9,11,  1,21, },
 	},
 	{
-    8,20, /* Ascii 90 */
-   17,21, 3, 0,-1,-1, 3,21,17,21,-1,-1, 3, 0,17, 0,
+		 8,20, /* Ascii 90 */
+		{ 17, 0,  3, 0, -1,-1,  3, 0, 17,21, -1,-1, 17,21,  3,21, },
 	},
 	{
-   11,14, /* Ascii 91 */
-    4,25, 4,-7,-1,-1, 5,25, 5,-7,-1,-1, 4,25,11,25,-1,-1, 4,-7,11,-7,
+		11,14, /* Ascii 91 */
+		{ 11,-7,  4,-7, -1,-1,  4,-7,  4,25, -1,-1,  4,25, 11,25, -1,-1,  5,25,
+		   5,-7, },
 	},
 	{
-    2,14, /* Ascii 92 */
-    0,21,14,-3,
+		 2,14, /* Ascii 92 */
+		{  0,21, 14,-3, },
 	},
 	{
-   11,14, /* Ascii 93 */
-    9,25, 9,-7,-1,-1,10,25,10,-7,-1,-1, 3,25,10,25,-1,-1, 3,-7,10,-7,
+		11,14, /* Ascii 93 */
+		{  3,-7, 10,-7, -1,-1, 10,-7, 10,25, -1,-1, 10,25,  3,25, -1,-1,  9,25,
+		   9,-7, },
 	},
 	{
-   10,16, /* Ascii 94 */
-    6,15, 8,18,10,15,-1,-1, 3,12, 8,17,13,12,-1,-1, 8,17, 8, 0,
+		10,16, /* Ascii 94 */
+		{  8, 0,  8,17, -1,-1, 10,15,  8,18,  6,15, -1,-1,  3,12,  8,17, 13,12, },
 	},
 	{
-    2,16, /* Ascii 95 */
-    0,-2,16,-2,
+		 2,16, /* Ascii 95 */
+		{  0,-2, 16,-2, },
 	},
 	{
-    7,10, /* Ascii 96 */
-    6,21, 5,20, 4,18, 4,16, 5,15, 6,16, 5,17,
+		 7,10, /* Ascii 96 */
+		{  6,21,  5,20,  4,18,  4,16,  5,15,  6,16,  5,17, },
 	},
 	{
-   17,19, /* Ascii 97 */
-   15,14,15, 0,-1,-1,15,11,13,13,11,14, 8,14, 6,13, 4,11, 3, 8, 3, 6, 4,
-    3, 6, 1, 8, 0,11, 0,13, 1,15, 3,
+		17,19, /* Ascii 97 */
+		{ 15, 3, 13, 1, 11, 0,  8, 0,  6, 1,  4, 3,  3, 6,  3, 8,  4,11,  6,13,
+		   8,14, 11,14, 13,13, 15,11, -1,-1, 15,14, 15, 0, },
 	},
 	{
-   17,19, /* Ascii 98 */
-    4,21, 4, 0,-1,-1, 4,11, 6,13, 8,14,11,14,13,13,15,11,16, 8,16, 6,15,
-    3,13, 1,11, 0, 8, 0, 6, 1, 4, 3,
+		17,19, /* Ascii 98 */
+		{  4,11,  6,13,  8,14, 11,14, 13,13, 15,11, 16, 8, 16, 6, 15, 3, 13, 1,
+		  11, 0,  8, 0,  6, 1,  4, 3, -1,-1,  4, 0,  4,21, },
 	},
 	{
-   14,18, /* Ascii 99 */
-   15,11,13,13,11,14, 8,14, 6,13, 4,11, 3, 8, 3, 6, 4, 3, 6, 1, 8, 0,11,
-    0,13, 1,15, 3,
+		14,18, /* Ascii 99 */
+		{ 15,11, 13,13, 11,14,  8,14,  6,13,  4,11,  3, 8,  3, 6,  4, 3,  6, 1,
+		   8, 0, 11, 0, 13, 1, 15, 3, },
 	},
 	{
-   17,19, /* Ascii 100 */
-   15,21,15, 0,-1,-1,15,11,13,13,11,14, 8,14, 6,13, 4,11, 3, 8, 3, 6, 4,
-    3, 6, 1, 8, 0,11, 0,13, 1,15, 3,
+		17,19, /* Ascii 100 */
+		{ 15,11, 13,13, 11,14,  8,14,  6,13,  4,11,  3, 8,  3, 6,  4, 3,  6, 1,
+		   8, 0, 11, 0, 13, 1, 15, 3, -1,-1, 15, 0, 15,21, },
 	},
 	{
-   17,18, /* Ascii 101 */
-    3, 8,15, 8,15,10,14,12,13,13,11,14, 8,14, 6,13, 4,11, 3, 8, 3, 6, 4,
-    3, 6, 1, 8, 0,11, 0,13, 1,15, 3,
+		17,18, /* Ascii 101 */
+		{  3, 8, 15, 8, 15,10, 14,12, 13,13, 11,14,  8,14,  6,13,  4,11,  3, 8,
+		   3, 6,  4, 3,  6, 1,  8, 0, 11, 0, 13, 1, 15, 3, },
 	},
 	{
-    8,12, /* Ascii 102 */
-   10,21, 8,21, 6,20, 5,17, 5, 0,-1,-1, 2,14, 9,14,
+		 8,12, /* Ascii 102 */
+		{  2,14,  9,14, -1,-1, 10,21,  8,21,  6,20,  5,17,  5, 0, },
 	},
 	{
-   22,19, /* Ascii 103 */
-   15,14,15,-2,14,-5,13,-6,11,-7, 8,-7, 6,-6,-1,-1,15,11,13,13,11,14, 8,
-   14, 6,13, 4,11, 3, 8, 3, 6, 4, 3, 6, 1, 8, 0,11, 0,13, 1,15, 3,
+		22,19, /* Ascii 103 */
+		{ 15, 3, 13, 1, 11, 0,  8, 0,  6, 1,  4, 3,  3, 6,  3, 8,  4,11,  6,13,
+		   8,14, 11,14, 13,13, 15,11, -1,-1, 15,14, 15,-2, 14,-5, 13,-6, 11,-7,
+		   8,-7,  6,-6, },
 	},
 	{
-   10,19, /* Ascii 104 */
-    4,21, 4, 0,-1,-1, 4,10, 7,13, 9,14,12,14,14,13,15,10,15, 0,
+		10,19, /* Ascii 104 */
+		{  4,21,  4, 0, -1,-1,  4,10,  7,13,  9,14, 12,14, 14,13, 15,10, 15, 0, },
 	},
 	{
-    8, 8, /* Ascii 105 */
-    3,21, 4,20, 5,21, 4,22, 3,21,-1,-1, 4,14, 4, 0,
+		 8, 8, /* Ascii 105 */
+		{  4, 0,  4,14, -1,-1,  4,20,  5,21,  4,22,  3,21,  4,20, },
 	},
 	{
-   11,10, /* Ascii 106 */
-    5,21, 6,20, 7,21, 6,22, 5,21,-1,-1, 6,14, 6,-3, 5,-6, 3,-7, 1,-7,
+		11,10, /* Ascii 106 */
+		{  1,-7,  3,-7,  5,-6,  6,-3,  6,14, -1,-1,  6,20,  7,21,  6,22,  5,21,
+		   6,20, },
 	},
 	{
-    8,17, /* Ascii 107 */
-    4,21, 4, 0,-1,-1,14,14, 4, 4,-1,-1, 8, 8,15, 0,
+		 8,17, /* Ascii 107 */
+		{ 15, 0,  8, 8, -1,-1, 14,14,  4, 4, -1,-1,  4, 0,  4,21, },
 	},
 	{
-    2, 8, /* Ascii 108 */
-    4,21, 4, 0,
+		 2, 8, /* Ascii 108 */
+		{  4,21,  4, 0, },
 	},
 	{
-   18,30, /* Ascii 109 */
-    4,14, 4, 0,-1,-1, 4,10, 7,13, 9,14,12,14,14,13,15,10,15, 0,-1,-1,15,
-   10,18,13,20,14,23,14,25,13,26,10,26, 0,
+		18,30, /* Ascii 109 */
+		{ 26, 0, 26,10, 25,13, 23,14, 20,14, 18,13, 15,10, -1,-1, 15, 0, 15,10,
+		  14,13, 12,14,  9,14,  7,13,  4,10, -1,-1,  4,14,  4, 0, },
 	},
 	{
-   10,19, /* Ascii 110 */
-    4,14, 4, 0,-1,-1, 4,10, 7,13, 9,14,12,14,14,13,15,10,15, 0,
+		10,19, /* Ascii 110 */
+		{ 15, 0, 15,10, 14,13, 12,14,  9,14,  7,13,  4,10, -1,-1,  4,14,  4, 0, },
 	},
 	{
-   17,19, /* Ascii 111 */
-    8,14, 6,13, 4,11, 3, 8, 3, 6, 4, 3, 6, 1, 8, 0,11, 0,13, 1,15, 3,16,
-    6,16, 8,15,11,13,13,11,14, 8,14,
+		17,19, /* Ascii 111 */
+		{  8,14,  6,13,  4,11,  3, 8,  3, 6,  4, 3,  6, 1,  8, 0, 11, 0, 13, 1,
+		  15, 3, 16, 6, 16, 8, 15,11, 13,13, 11,14,  8,14, },
 	},
 	{
-   17,19, /* Ascii 112 */
-    4,14, 4,-7,-1,-1, 4,11, 6,13, 8,14,11,14,13,13,15,11,16, 8,16, 6,15,
-    3,13, 1,11, 0, 8, 0, 6, 1, 4, 3,
+		17,19, /* Ascii 112 */
+		{  4, 3,  6, 1,  8, 0, 11, 0, 13, 1, 15, 3, 16, 6, 16, 8, 15,11, 13,13,
+		  11,14,  8,14,  6,13,  4,11, -1,-1,  4,14,  4,-7, },
 	},
 	{
-   17,19, /* Ascii 113 */
-   15,14,15,-7,-1,-1,15,11,13,13,11,14, 8,14, 6,13, 4,11, 3, 8, 3, 6, 4,
-    3, 6, 1, 8, 0,11, 0,13, 1,15, 3,
+		17,19, /* Ascii 113 */
+		{ 15, 3, 13, 1, 11, 0,  8, 0,  6, 1,  4, 3,  3, 6,  3, 8,  4,11,  6,13,
+		   8,14, 11,14, 13,13, 15,11, -1,-1, 15,14, 15,-7, },
 	},
 	{
-    8,13, /* Ascii 114 */
-    4,14, 4, 0,-1,-1, 4, 8, 5,11, 7,13, 9,14,12,14,
+		 8,13, /* Ascii 114 */
+		{ 12,14,  9,14,  7,13,  5,11,  4, 8, -1,-1,  4,14,  4, 0, },
 	},
 	{
-   17,17, /* Ascii 115 */
-   14,11,13,13,10,14, 7,14, 4,13, 3,11, 4, 9, 6, 8,11, 7,13, 6,14, 4,14,
-    3,13, 1,10, 0, 7, 0, 4, 1, 3, 3,
+		17,17, /* Ascii 115 */
+		{ 14,11, 13,13, 10,14,  7,14,  4,13,  3,11,  4, 9,  6, 8, 11, 7, 13, 6,
+		  14, 4, 14, 3, 13, 1, 10, 0,  7, 0,  4, 1,  3, 3, },
 	},
 	{
-    8,12, /* Ascii 116 */
-    5,21, 5, 4, 6, 1, 8, 0,10, 0,-1,-1, 2,14, 9,14,
+		 8,12, /* Ascii 116 */
+		{  9,14,  2,14, -1,-1,  5,21,  5, 4,  6, 1,  8, 0, 10, 0, },
 	},
 	{
-   10,19, /* Ascii 117 */
-    4,14, 4, 4, 5, 1, 7, 0,10, 0,12, 1,15, 4,-1,-1,15,14,15, 0,
+		10,19, /* Ascii 117 */
+		{ 15,14, 15, 0, -1,-1, 15, 4, 12, 1, 10, 0,  7, 0,  5, 1,  4, 4,  4,14, },
 	},
 	{
-    5,16, /* Ascii 118 */
-    2,14, 8, 0,-1,-1,14,14, 8, 0,
+		 5,16, /* Ascii 118 */
+		{ 14,14,  8, 0, -1,-1,  8, 0,  2,14, },
 	},
 	{
-   11,22, /* Ascii 119 */
-    3,14, 7, 0,-1,-1,11,14, 7, 0,-1,-1,11,14,15, 0,-1,-1,19,14,15, 0,
+		11,22, /* Ascii 119 */
+		{ 19,14, 15, 0, -1,-1, 15, 0, 11,14, -1,-1, 11,14,  7, 0, -1,-1,  7, 0,
+		   3,14, },
 	},
 	{
-    5,17, /* Ascii 120 */
-    3,14,14, 0,-1,-1,14,14, 3, 0,
+		 5,17, /* Ascii 120 */
+		{  3, 0, 14,14, -1,-1,  3,14, 14, 0, },
 	},
 	{
-    9,16, /* Ascii 121 */
-    2,14, 8, 0,-1,-1,14,14, 8, 0, 6,-4, 4,-6, 2,-7, 1,-7,
+		 9,16, /* Ascii 121 */
+		{  1,-7,  2,-7,  4,-6,  6,-4,  8, 0, 14,14, -1,-1,  2,14,  8, 0, },
 	},
 	{
-    8,17, /* Ascii 122 */
-   14,14, 3, 0,-1,-1, 3,14,14,14,-1,-1, 3, 0,14, 0,
+		 8,17, /* Ascii 122 */
+		{ 14, 0,  3, 0, -1,-1,  3, 0, 14,14, -1,-1, 14,14,  3,14, },
 	},
 	{
-#if 0
-   39,14, /* Ascii 123 */
-    9,25, 7,24, 6,23, 5,21, 5,19, 6,17, 7,16, 8,14, 8,12, 6,10,-1,-1, 7,
-   24, 6,22, 6,20, 7,18, 8,17, 9,15, 9,13, 8,11, 4, 9, 8, 7, 9, 5, 9, 3,
-    8, 1, 7, 0, 6,-2, 6,-4, 7,-6,-1,-1, 6, 8, 8, 6, 8, 4, 7, 2, 6, 1, 5,
-   -1, 5,-3, 6,-5, 7,-6, 9,-7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-#endif
+		 0, 0, /* Ascii 123 */
 	},
 	{
-    2, 8, /* Ascii 124 */
-    4,25, 4,-7,
+		 2, 8, /* Ascii 124 */
+		{  4,25,  4,-7, },
 	},
 	{
-#if 0
-   39,14, /* Ascii 125 */
-    5,25, 7,24, 8,23, 9,21, 9,19, 8,17, 7,16, 6,14, 6,12, 8,10,-1,-1, 7,
-   24, 8,22, 8,20, 7,18, 6,17, 5,15, 5,13, 6,11,10, 9, 6, 7, 5, 5, 5, 3,
-    6, 1, 7, 0, 8,-2, 8,-4, 7,-6,-1,-1, 8, 8, 6, 6, 6, 4, 7, 2, 8, 1, 9,
-   -1, 9,-3, 8,-5, 7,-6, 5,-7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-   -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-#endif
+		 0, 0, /* Ascii 125 */
 	},
 	{
-   23,24, /* Ascii 126 */
-    3, 6, 3, 8, 4,11, 6,12, 8,12,10,11,14, 8,16, 7,18, 7,20, 8,21,10,-1,
-   -1, 3, 8, 4,10, 6,11, 8,11,10,10,14, 7,16, 6,18, 6,20, 7,21,10,21,12,
+		23,24, /* Ascii 126 */
+		{ 21,12, 21,10, 20, 7, 18, 6, 16, 6, 14, 7, 10,10,  8,11,  6,11,  4,10,
+		   3, 8, -1,-1,  3, 6,  3, 8,  4,11,  6,12,  8,12, 10,11, 14, 8, 16, 7,
+		  18, 7, 20, 8, 21,10, },
 	},
 };
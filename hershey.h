@@ -2,7 +2,13 @@
 #define _hershey_h_
 
 #include <stdint.h>
+#include "font.h"
 
+/** Source format of the Hershey fonts.
+ *
+ * This is only used by fontgen on the host; the firmware links the
+ * compressed tables described below.
+ */
 typedef struct
 {
 	uint8_t count;
@@ -13,4 +19,44 @@ typedef struct
 
 extern const hershey_char_t hershey_simplex[];
 
+
+/** Compressed Hershey glyph stream.
+ *
+ * Each glyph starts with its width, followed by one byte per point.
+ * A point is normally a delta from the previous point with dx in
+ * the high nibble and dy in the low nibble, both signed.  A dx of -8
+ * is never used for a delta, which leaves room for the opcodes.
+ * The first point of a glyph is relative to (0,0) and the position
+ * is kept across pen-ups.  Generated by "./fontgen compress".
+ */
+#define HERSHEY_END	0x80
+#define HERSHEY_PEN_UP	0x81
+#define HERSHEY_ABS	0x82 // followed by int8_t x, y
+
+
+/** Level-of-detail masks for the two smallest draw_char scales.
+ * Bit i is set if entry i of the glyph (counting pen-ups) should be
+ * drawn at that scale; the others are within one DAC step of the
+ * simplified outline.  Each glyph has lod_bytes of mask for each
+ * scale, enough for the longest glyph in the font, least significant
+ * bit first.
+ */
+#define HERSHEY_LOD_SCALES 2
+
+
+/** A compressed Hershey font in program memory */
+typedef struct
+{
+	const uint8_t * data;
+	const uint16_t * offset;
+	const uint8_t * lod;
+	uint8_t lod_bytes;
+	const glyph_bbox_t * bbox;
+} hershey_font_t;
+
+
+/** Declare the font written by "./fontgen compress name" */
+#define HERSHEY_FONT_DECLARE(name) \
+	extern const hershey_font_t hershey_##name##_font
+
 #endif
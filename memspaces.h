@@ -6,9 +6,15 @@
 
 #ifdef __AVR__
 #include <avr/pgmspace.h>
+#ifndef pgm_read_ptr
+#define pgm_read_ptr(p) ((void*) pgm_read_word(p))
+#endif
 #else
 #define PROGMEM /* Nop */
 #define pgm_read_byte(p) *((const uint8_t*) p)
+#define pgm_read_word(p) *((const uint16_t*) p)
+#define pgm_read_dword(p) *((const uint32_t*) p)
+#define pgm_read_ptr(p) *((void * const *) p)
 #endif
 
 #endif
@@ -0,0 +1,263 @@
+/** \file
+ * Host benchmark and frame generator for the Barnes-Hut simulation.
+ *
+ *	make nbody-bench
+ *	./nbody-bench [-n bodies] [-j threads] [-s steps] [-t theta]
+ *	./nbody-bench -f frames [-n bodies] [-j threads] > frames.txt
+ *
+ * Without -f the benchmark runs a disk of bodies around a heavy
+ * centre for each number of bodies up to -n and each number of
+ * threads up to -j, and reports the interactions per second and the
+ * time per step, with a step under 20 ms counted as real time at the
+ * 50 Hz refresh of the scope.  For the smallest disk the energy drift
+ * is also compared against direct summation with theta of 0.
+ *
+ * With -f the display lists of each frame are printed in the same
+ * format as the host spacerocks, one segment per pair of lines and
+ * "---" between frames.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <math.h>
+#include "nbody.h"
+
+#define DT		0.0005
+#define SOFTENING	0.005
+#define CENTRE_MASS	1.0
+#define DISK_MASS	0.1
+#define REALTIME_NS	20e6
+
+/** Display list budget of a frame */
+#define DISPLAY_MAX	16384
+
+
+/** Uniform in [0,1) from a private rand48 state */
+static double
+uniform(
+	unsigned short * const rng
+)
+{
+	return erand48(rng);
+}
+
+
+/** A heavy body at the centre and a disk of light bodies on roughly
+ * circular orbits, each moving at the speed for the mass inside it.
+ */
+static nbody_t *
+disk_create(
+	const unsigned n,
+	const unsigned threads,
+	const unsigned trail_len,
+	const double theta
+)
+{
+	nbody_t * const nb = nbody_create(n, trail_len, 8, threads);
+	if (!nb)
+	{
+		perror("nbody_create");
+		exit(EXIT_FAILURE);
+	}
+
+	unsigned short rng[3] = { 0x1234, 0x5678, 0x9ABC };
+	const double m = DISK_MASS / (n - 1);
+
+	nbody_params(nb, DT, 1, SOFTENING, theta);
+	nbody_add(nb, 0, 0, 0, 0, CENTRE_MASS);
+
+	for (unsigned i = 1 ; i < n ; i++)
+	{
+		// uniform over the area between r = 0.1 and 1
+		const double r = sqrt(0.01 + 0.99 * uniform(rng));
+		const double a = 2 * M_PI * uniform(rng);
+		const double inside = CENTRE_MASS + DISK_MASS * (r * r - 0.01) / 0.99;
+		const double v = sqrt(inside / r);
+
+		nbody_add(nb,
+			r * cos(a),
+			r * sin(a),
+			-v * sin(a),
+			v * cos(a),
+			m
+		);
+	}
+
+	return nb;
+}
+
+
+static void
+frames(
+	const unsigned n,
+	const unsigned threads,
+	const unsigned count
+)
+{
+	nbody_t * const nb = disk_create(n, threads, 32, 0.5);
+	const nbody_view_t view = { 0, 0, 120 };
+	static nbody_vertex_t list[DISPLAY_MAX];
+
+	for (unsigned f = 0 ; f < count ; f++)
+	{
+		// four steps per 50 Hz frame
+		for (unsigned k = 0 ; k < 4 ; k++)
+			nbody_step(nb);
+
+		const size_t len = nbody_display(nb, &view, list, DISPLAY_MAX);
+		for (size_t i = 1 ; i < len ; i++)
+		{
+			if (list[i].flags & NBODY_MOVE)
+				continue;
+			printf("%d %d\n%d %d\n\n",
+				list[i-1].x,
+				list[i-1].y,
+				list[i].x,
+				list[i].y
+			);
+		}
+		printf("---\n");
+	}
+
+	nbody_free(nb);
+}
+
+
+/** Relative energy change after a number of steps */
+static double
+drift(
+	const unsigned n,
+	const double theta,
+	const unsigned steps
+)
+{
+	nbody_t * const nb = disk_create(n, 1, 0, theta);
+	const double e0 = nbody_energy(nb);
+
+	for (unsigned t = 0 ; t < steps ; t++)
+		nbody_step(nb);
+
+	const double de = nbody_energy(nb) / e0 - 1;
+	nbody_free(nb);
+	return de;
+}
+
+
+int
+main(
+	int argc,
+	char ** argv
+)
+{
+	unsigned max_n = 16384;
+	unsigned max_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned steps = 20;
+	unsigned frame_count = 0;
+	double theta = 0.5;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:j:s:t:f:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'n': max_n = strtoul(optarg, NULL, 0); break;
+		case 'j': max_threads = strtoul(optarg, NULL, 0); break;
+		case 's': steps = strtoul(optarg, NULL, 0); break;
+		case 't': theta = strtod(optarg, NULL); break;
+		case 'f': frame_count = strtoul(optarg, NULL, 0); break;
+		default:
+			fprintf(stderr, "usage: %s [-n bodies] [-j threads] [-s steps] [-t theta] [-f frames]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (max_threads < 1)
+		max_threads = 1;
+	if (max_n < 256)
+		max_n = 256;
+
+	if (frame_count)
+	{
+		frames(max_n, max_threads, frame_count);
+		return 0;
+	}
+
+	printf("dE/E after 1000 steps of 256 bodies: theta %.2f %.2e, direct %.2e\n",
+		theta,
+		drift(256, theta, 1000),
+		drift(256, 0, 1000)
+	);
+
+	printf("%6s %3s %10s %8s %8s %8s %12s %s\n",
+		"bodies",
+		"thr",
+		"inter/body",
+		"build ms",
+		"force ms",
+		"step ms",
+		"inter/s",
+		"real time"
+	);
+
+	for (unsigned n = 256 ; n <= max_n ; n *= 4)
+	{
+		for (unsigned threads = 1 ; threads <= max_threads ; threads *= 2)
+		{
+			nbody_t * const nb = disk_create(n, threads, 0, theta);
+			double build = 0;
+			double force = 0;
+			double interactions = 0;
+
+			// the first step also primes the accelerations
+			nbody_step(nb);
+
+			for (unsigned t = 0 ; t < steps ; t++)
+			{
+				nbody_step(nb);
+				const nbody_stats_t * const s = nbody_stats(nb);
+				build += s->build_ns;
+				force += s->force_ns;
+				interactions += s->interactions;
+			}
+
+			const double step_ns = (build + force) / steps;
+			printf("%6u %3u %10.1f %8.3f %8.3f %8.3f %12.3e %s\n",
+				n,
+				threads,
+				interactions / steps / n,
+				build / steps / 1e6,
+				force / steps / 1e6,
+				step_ns / 1e6,
+				interactions / (force / 1e9),
+				step_ns < REALTIME_NS ? "yes" : "no"
+			);
+
+			nbody_free(nb);
+
+			if (threads * 2 > max_threads && threads != max_threads)
+				threads = max_threads / 2;
+		}
+
+		// direct summation for comparison
+		if (n <= 4096)
+		{
+			nbody_t * const nb = disk_create(n, 1, 0, 0);
+			nbody_step(nb);
+			nbody_step(nb);
+			const nbody_stats_t * const s = nbody_stats(nb);
+			printf("%6u %3s %10.1f %8.3f %8.3f %8.3f %12.3e %s\n",
+				n,
+				"dir",
+				(double) s->interactions / n,
+				s->build_ns / 1e6,
+				s->force_ns / 1e6,
+				(s->build_ns + s->force_ns) / 1e6,
+				s->interactions / (s->force_ns / 1e9),
+				s->build_ns + s->force_ns < REALTIME_NS ? "yes" : "no"
+			);
+			nbody_free(nb);
+		}
+	}
+
+	return 0;
+}
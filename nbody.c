@@ -0,0 +1,771 @@
+/** \file
+ * Barnes-Hut N-body simulation for the host.
+ *
+ * The quadtree nodes live in one array and refer to their children by
+ * index, so it can grow with realloc() and is rebuilt in place every
+ * step.  Children are always added after their parent, which lets the
+ * masses be summed in a single pass backwards over the array.
+ *
+ * The force pass hands out chunks of bodies from a shared counter,
+ * since bodies in the dense middle of a cluster open many more nodes
+ * than the ones at the edge.  The pool threads wait on a barrier
+ * between steps rather than being created for each one.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include "nbody.h"
+
+/** Bodies per chunk of the force pass */
+#define NBODY_CHUNK	64
+
+/** Below this depth coincident bodies share a leaf */
+#define NBODY_MAX_DEPTH	48
+
+/** Deep enough for NBODY_MAX_DEPTH levels of four children */
+#define NBODY_STACK	(4 * NBODY_MAX_DEPTH + 4)
+
+
+typedef struct
+{
+	double cx; // centre of the square
+	double cy;
+	double half; // half the side
+	double mx; // centre of mass
+	double my;
+	double m;
+	int32_t child[4]; // -1 if empty
+	int32_t body; // first body of a leaf, -1 if an inner node
+} nbody_node_t;
+
+
+typedef struct
+{
+	nbody_t * nb;
+	unsigned id;
+	pthread_t thread;
+	uint64_t interactions;
+} nbody_worker_t;
+
+
+struct nbody
+{
+	unsigned n;
+	unsigned capacity;
+	double * x;
+	double * y;
+	double * vx;
+	double * vy;
+	double * ax;
+	double * ay;
+	double * m;
+	int32_t * next; // next body in the same leaf
+
+	double dt;
+	double g;
+	double eps2;
+	double theta2;
+	int primed;
+
+	nbody_node_t * nodes;
+	unsigned node_count;
+	unsigned node_capacity;
+
+	unsigned trail_len;
+	unsigned trail_every;
+	unsigned trail_count; // valid entries, up to trail_len
+	unsigned trail_head; // next to be written
+	unsigned trail_tick;
+	float * trail; // trail_len * capacity * 2, oldest first from head
+
+	unsigned threads;
+	nbody_worker_t * workers;
+	pthread_barrier_t start;
+	pthread_barrier_t done;
+	int quit;
+	unsigned next_chunk;
+
+	nbody_stats_t stats;
+};
+
+
+static double
+now_ns(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+
+static int
+node_new(
+	nbody_t * const nb,
+	const double cx,
+	const double cy,
+	const double half
+)
+{
+	if (nb->node_count == nb->node_capacity)
+	{
+		nb->node_capacity *= 2;
+		nb->nodes = realloc(nb->nodes, nb->node_capacity * sizeof(*nb->nodes));
+		if (!nb->nodes)
+		{
+			perror("nbody nodes");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	nbody_node_t * const node = &nb->nodes[nb->node_count];
+	node->cx = cx;
+	node->cy = cy;
+	node->half = half;
+	node->m = 0;
+	node->child[0] = node->child[1] = node->child[2] = node->child[3] = -1;
+	node->body = -1;
+
+	return nb->node_count++;
+}
+
+
+static inline unsigned
+quadrant(
+	const nbody_node_t * const node,
+	const double x,
+	const double y
+)
+{
+	return (x >= node->cx) | (y >= node->cy) << 1;
+}
+
+
+/** Child of a node for a quadrant, creating it if needed.
+ * The node array may move, so this returns an index.
+ */
+static int
+node_child(
+	nbody_t * const nb,
+	const int parent,
+	const unsigned q
+)
+{
+	const nbody_node_t * const p = &nb->nodes[parent];
+	if (p->child[q] >= 0)
+		return p->child[q];
+
+	const double h = p->half / 2;
+	const int c = node_new(nb,
+		p->cx + (q & 1 ? h : -h),
+		p->cy + (q & 2 ? h : -h),
+		h
+	);
+	nb->nodes[parent].child[q] = c;
+	return c;
+}
+
+
+static int
+is_leaf(
+	const nbody_node_t * const node
+)
+{
+	return node->child[0] < 0
+		&& node->child[1] < 0
+		&& node->child[2] < 0
+		&& node->child[3] < 0;
+}
+
+
+static void
+tree_insert(
+	nbody_t * const nb,
+	const int i
+)
+{
+	const double x = nb->x[i];
+	const double y = nb->y[i];
+	int node = 0;
+
+	for (unsigned depth = 0 ;; depth++)
+	{
+		nbody_node_t * const n = &nb->nodes[node];
+
+		if (!is_leaf(n))
+		{
+			node = node_child(nb, node, quadrant(n, x, y));
+			continue;
+		}
+
+		if (n->body < 0 || depth >= NBODY_MAX_DEPTH)
+		{
+			// empty leaf, or too deep to split any further
+			nb->next[i] = n->body;
+			n->body = i;
+			return;
+		}
+
+		// split the leaf and push its body down a level
+		const int j = n->body;
+		n->body = -1;
+		const int c = node_child(nb, node, quadrant(n, nb->x[j], nb->y[j]));
+		nb->nodes[c].body = j;
+		nb->next[j] = -1;
+	}
+}
+
+
+static void
+tree_build(
+	nbody_t * const nb
+)
+{
+	double x0 = nb->x[0];
+	double x1 = x0;
+	double y0 = nb->y[0];
+	double y1 = y0;
+
+	for (unsigned i = 1 ; i < nb->n ; i++)
+	{
+		if (nb->x[i] < x0) x0 = nb->x[i];
+		if (nb->x[i] > x1) x1 = nb->x[i];
+		if (nb->y[i] < y0) y0 = nb->y[i];
+		if (nb->y[i] > y1) y1 = nb->y[i];
+	}
+
+	double half = (x1 - x0 > y1 - y0 ? x1 - x0 : y1 - y0) / 2;
+	half = half * 1.0001 + 1e-9;
+
+	nb->node_count = 0;
+	node_new(nb, (x0 + x1) / 2, (y0 + y1) / 2, half);
+
+	for (unsigned i = 0 ; i < nb->n ; i++)
+		tree_insert(nb, i);
+
+	// children come after their parents, so sum from the end
+	for (int k = nb->node_count - 1 ; k >= 0 ; k--)
+	{
+		nbody_node_t * const n = &nb->nodes[k];
+		double m = 0;
+		double mx = 0;
+		double my = 0;
+
+		if (n->body >= 0)
+		{
+			for (int j = n->body ; j >= 0 ; j = nb->next[j])
+			{
+				m += nb->m[j];
+				mx += nb->m[j] * nb->x[j];
+				my += nb->m[j] * nb->y[j];
+			}
+		} else {
+			for (unsigned q = 0 ; q < 4 ; q++)
+			{
+				if (n->child[q] < 0)
+					continue;
+				const nbody_node_t * const c = &nb->nodes[n->child[q]];
+				m += c->m;
+				mx += c->m * c->mx;
+				my += c->m * c->my;
+			}
+		}
+
+		n->m = m;
+		n->mx = m > 0 ? mx / m : n->cx;
+		n->my = m > 0 ? my / m : n->cy;
+	}
+}
+
+
+/** Acceleration on one body from the tree.
+ * Returns the number of interactions.
+ */
+static unsigned
+body_accel(
+	nbody_t * const nb,
+	const int i
+)
+{
+	const double x = nb->x[i];
+	const double y = nb->y[i];
+	const double eps2 = nb->eps2;
+	double ax = 0;
+	double ay = 0;
+	unsigned count = 0;
+
+	int stack[NBODY_STACK];
+	unsigned sp = 0;
+	stack[sp++] = 0;
+
+	while (sp)
+	{
+		const nbody_node_t * const n = &nb->nodes[stack[--sp]];
+		if (n->m == 0)
+			continue;
+
+		const double dx = n->mx - x;
+		const double dy = n->my - y;
+		const double d2 = dx * dx + dy * dy;
+		const double size = 2 * n->half;
+
+		if (n->body >= 0)
+		{
+			for (int j = n->body ; j >= 0 ; j = nb->next[j])
+			{
+				if (j == i)
+					continue;
+				const double bx = nb->x[j] - x;
+				const double by = nb->y[j] - y;
+				const double r2 = bx * bx + by * by + eps2;
+				const double f = nb->m[j] / (r2 * sqrt(r2));
+				ax += f * bx;
+				ay += f * by;
+				count++;
+			}
+			continue;
+		}
+
+		if (size * size < nb->theta2 * d2)
+		{
+			const double r2 = d2 + eps2;
+			const double f = n->m / (r2 * sqrt(r2));
+			ax += f * dx;
+			ay += f * dy;
+			count++;
+			continue;
+		}
+
+		for (unsigned q = 0 ; q < 4 ; q++)
+			if (n->child[q] >= 0)
+				stack[sp++] = n->child[q];
+	}
+
+	nb->ax[i] = nb->g * ax;
+	nb->ay[i] = nb->g * ay;
+	return count;
+}
+
+
+static void
+force_chunks(
+	nbody_worker_t * const w
+)
+{
+	nbody_t * const nb = w->nb;
+	uint64_t count = 0;
+
+	while (1)
+	{
+		const unsigned start = __atomic_fetch_add(
+			&nb->next_chunk,
+			NBODY_CHUNK,
+			__ATOMIC_RELAXED
+		);
+		if (start >= nb->n)
+			break;
+
+		unsigned end = start + NBODY_CHUNK;
+		if (end > nb->n)
+			end = nb->n;
+
+		for (unsigned i = start ; i < end ; i++)
+			count += body_accel(nb, i);
+	}
+
+	w->interactions = count;
+}
+
+
+static void *
+worker_main(
+	void * const arg
+)
+{
+	nbody_worker_t * const w = arg;
+	nbody_t * const nb = w->nb;
+
+	while (1)
+	{
+		pthread_barrier_wait(&nb->start);
+		if (nb->quit)
+			break;
+		force_chunks(w);
+		pthread_barrier_wait(&nb->done);
+	}
+
+	return NULL;
+}
+
+
+static void
+force_pass(
+	nbody_t * const nb
+)
+{
+	const double t0 = now_ns();
+	tree_build(nb);
+	const double t1 = now_ns();
+
+	nb->next_chunk = 0;
+	if (nb->threads > 1)
+		pthread_barrier_wait(&nb->start);
+	force_chunks(&nb->workers[0]);
+	if (nb->threads > 1)
+		pthread_barrier_wait(&nb->done);
+
+	const double t2 = now_ns();
+
+	nb->stats.interactions = 0;
+	for (unsigned t = 0 ; t < nb->threads ; t++)
+		nb->stats.interactions += nb->workers[t].interactions;
+	nb->stats.nodes = nb->node_count;
+	nb->stats.build_ns = t1 - t0;
+	nb->stats.force_ns = t2 - t1;
+}
+
+
+nbody_t *
+nbody_create(
+	const unsigned capacity,
+	const unsigned trail_len,
+	const unsigned trail_every,
+	const unsigned threads
+)
+{
+	nbody_t * const nb = calloc(1, sizeof(*nb));
+	if (!nb)
+		return NULL;
+
+	nb->capacity = capacity;
+	nb->x = calloc(capacity, sizeof(*nb->x));
+	nb->y = calloc(capacity, sizeof(*nb->y));
+	nb->vx = calloc(capacity, sizeof(*nb->vx));
+	nb->vy = calloc(capacity, sizeof(*nb->vy));
+	nb->ax = calloc(capacity, sizeof(*nb->ax));
+	nb->ay = calloc(capacity, sizeof(*nb->ay));
+	nb->m = calloc(capacity, sizeof(*nb->m));
+	nb->next = calloc(capacity, sizeof(*nb->next));
+
+	nb->node_capacity = 2 * capacity + 16;
+	nb->nodes = calloc(nb->node_capacity, sizeof(*nb->nodes));
+
+	nb->trail_len = trail_len;
+	nb->trail_every = trail_every ? trail_every : 1;
+	if (trail_len)
+		nb->trail = calloc((size_t) trail_len * capacity * 2, sizeof(*nb->trail));
+
+	if (!nb->x || !nb->y || !nb->vx || !nb->vy
+	||  !nb->ax || !nb->ay || !nb->m || !nb->next
+	||  !nb->nodes || (trail_len && !nb->trail))
+	{
+		nb->threads = 0;
+		nbody_free(nb);
+		return NULL;
+	}
+
+	nbody_params(nb, 0.01, 1, 0.01, 0.5);
+
+	nb->threads = threads ? threads : 1;
+	nb->workers = calloc(nb->threads, sizeof(*nb->workers));
+	for (unsigned t = 0 ; t < nb->threads ; t++)
+	{
+		nb->workers[t].nb = nb;
+		nb->workers[t].id = t;
+	}
+
+	if (nb->threads > 1)
+	{
+		pthread_barrier_init(&nb->start, NULL, nb->threads);
+		pthread_barrier_init(&nb->done, NULL, nb->threads);
+
+		// worker 0 is the calling thread
+		for (unsigned t = 1 ; t < nb->threads ; t++)
+			pthread_create(&nb->workers[t].thread, NULL, worker_main, &nb->workers[t]);
+	}
+
+	return nb;
+}
+
+
+void
+nbody_free(
+	nbody_t * const nb
+)
+{
+	if (!nb)
+		return;
+
+	if (nb->threads > 1)
+	{
+		nb->quit = 1;
+		pthread_barrier_wait(&nb->start);
+		for (unsigned t = 1 ; t < nb->threads ; t++)
+			pthread_join(nb->workers[t].thread, NULL);
+		pthread_barrier_destroy(&nb->start);
+		pthread_barrier_destroy(&nb->done);
+	}
+
+	free(nb->workers);
+	free(nb->x);
+	free(nb->y);
+	free(nb->vx);
+	free(nb->vy);
+	free(nb->ax);
+	free(nb->ay);
+	free(nb->m);
+	free(nb->next);
+	free(nb->nodes);
+	free(nb->trail);
+	free(nb);
+}
+
+
+void
+nbody_params(
+	nbody_t * const nb,
+	const double dt,
+	const double g,
+	const double softening,
+	const double theta
+)
+{
+	nb->dt = dt;
+	nb->g = g;
+	nb->eps2 = softening * softening;
+	nb->theta2 = theta * theta;
+	nb->primed = 0;
+}
+
+
+int
+nbody_add(
+	nbody_t * const nb,
+	const double x,
+	const double y,
+	const double vx,
+	const double vy,
+	const double m
+)
+{
+	if (nb->n == nb->capacity)
+		return -1;
+
+	const unsigned i = nb->n++;
+	nb->x[i] = x;
+	nb->y[i] = y;
+	nb->vx[i] = vx;
+	nb->vy[i] = vy;
+	nb->m[i] = m;
+
+	// the accelerations are stale now
+	nb->primed = 0;
+
+	// start the trail where the body is
+	for (unsigned k = 0 ; k < nb->trail_len ; k++)
+	{
+		float * const p = &nb->trail[((size_t) k * nb->capacity + i) * 2];
+		p[0] = x;
+		p[1] = y;
+	}
+
+	return i;
+}
+
+
+unsigned
+nbody_count(
+	const nbody_t * const nb
+)
+{
+	return nb->n;
+}
+
+
+static void
+trail_record(
+	nbody_t * const nb
+)
+{
+	if (!nb->trail_len)
+		return;
+	if (++nb->trail_tick < nb->trail_every)
+		return;
+	nb->trail_tick = 0;
+
+	float * const p = &nb->trail[(size_t) nb->trail_head * nb->capacity * 2];
+	for (unsigned i = 0 ; i < nb->n ; i++)
+	{
+		p[2*i + 0] = nb->x[i];
+		p[2*i + 1] = nb->y[i];
+	}
+
+	if (++nb->trail_head == nb->trail_len)
+		nb->trail_head = 0;
+	if (nb->trail_count < nb->trail_len)
+		nb->trail_count++;
+}
+
+
+void
+nbody_step(
+	nbody_t * const nb
+)
+{
+	if (nb->n == 0)
+		return;
+
+	if (!nb->primed)
+	{
+		force_pass(nb);
+		nb->primed = 1;
+	}
+
+	const double dt = nb->dt;
+	const double half = dt / 2;
+
+	for (unsigned i = 0 ; i < nb->n ; i++)
+	{
+		nb->vx[i] += nb->ax[i] * half;
+		nb->vy[i] += nb->ay[i] * half;
+		nb->x[i] += nb->vx[i] * dt;
+		nb->y[i] += nb->vy[i] * dt;
+	}
+
+	force_pass(nb);
+
+	for (unsigned i = 0 ; i < nb->n ; i++)
+	{
+		nb->vx[i] += nb->ax[i] * half;
+		nb->vy[i] += nb->ay[i] * half;
+	}
+
+	trail_record(nb);
+}
+
+
+double
+nbody_energy(
+	const nbody_t * const nb
+)
+{
+	double e = 0;
+
+	for (unsigned i = 0 ; i < nb->n ; i++)
+	{
+		e += nb->m[i] * (nb->vx[i] * nb->vx[i] + nb->vy[i] * nb->vy[i]) / 2;
+
+		for (unsigned j = i + 1 ; j < nb->n ; j++)
+		{
+			const double dx = nb->x[j] - nb->x[i];
+			const double dy = nb->y[j] - nb->y[i];
+			e -= nb->g * nb->m[i] * nb->m[j] / sqrt(dx * dx + dy * dy + nb->eps2);
+		}
+	}
+
+	return e;
+}
+
+
+const nbody_stats_t *
+nbody_stats(
+	const nbody_t * const nb
+)
+{
+	return &nb->stats;
+}
+
+
+/** Screen position of a world position, or 0 if it is off screen */
+static int
+view_map(
+	const nbody_view_t * const view,
+	const double x,
+	const double y,
+	nbody_vertex_t * const v
+)
+{
+	const double sx = (x - view->cx) * view->scale + 128;
+	const double sy = (y - view->cy) * view->scale + 128;
+
+	if (sx < 0 || sx >= 256 || sy < 0 || sy >= 256)
+		return 0;
+
+	v->x = sx;
+	v->y = sy;
+	return 1;
+}
+
+
+size_t
+nbody_display(
+	const nbody_t * const nb,
+	const nbody_view_t * const view,
+	nbody_vertex_t * const list,
+	const size_t max
+)
+{
+	size_t len = 0;
+
+	for (unsigned i = 0 ; i < nb->n ; i++)
+	{
+		nbody_vertex_t v;
+		if (!view_map(view, nb->x[i], nb->y[i], &v))
+			continue;
+
+		// a point is a move followed by a line of no length
+		if (len + 2 > max)
+			return len;
+		v.flags = NBODY_MOVE;
+		list[len++] = v;
+		v.flags = 0;
+		list[len++] = v;
+	}
+
+	// oldest position first, ending at the body
+	const unsigned oldest = nb->trail_count < nb->trail_len ? 0 : nb->trail_head;
+
+	for (unsigned i = 0 ; i < nb->n && nb->trail_count ; i++)
+	{
+		int pen = 0;
+		nbody_vertex_t last = { 0, 0, 0 };
+
+		for (unsigned k = 0 ; k <= nb->trail_count ; k++)
+		{
+			double x;
+			double y;
+			if (k == nb->trail_count)
+			{
+				x = nb->x[i];
+				y = nb->y[i];
+			} else {
+				const unsigned slot = (oldest + k) % nb->trail_len;
+				const float * const p = &nb->trail[((size_t) slot * nb->capacity + i) * 2];
+				x = p[0];
+				y = p[1];
+			}
+
+			nbody_vertex_t v;
+			if (!view_map(view, x, y, &v))
+			{
+				pen = 0;
+				continue;
+			}
+
+			// skip points that land on the same pixel
+			if (pen && v.x == last.x && v.y == last.y)
+				continue;
+
+			if (len == max)
+				return len;
+			v.flags = pen ? 0 : NBODY_MOVE;
+			list[len++] = v;
+			last = v;
+			pen = 1;
+		}
+	}
+
+	return len;
+}
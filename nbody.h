@@ -0,0 +1,137 @@
+/** \file
+ * Barnes-Hut N-body simulation for the host.
+ *
+ * Unlike spacewar, which only pulls the planets towards a fixed sun,
+ * every body attracts every other one.  The bodies are sorted into a
+ * quadtree every step, and distant groups of bodies are treated as a
+ * single mass at their centre, which makes a step O(n log n).  The
+ * force pass is split between a pool of threads.
+ *
+ * Frames are produced as vector display lists of points and orbit
+ * trails in the 0 to 255 scope coordinates.
+ */
+#ifndef _nbody_h_
+#define _nbody_h_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct nbody nbody_t;
+
+
+/** A display list entry: a line from the previous vertex to this
+ * one, or a move with the beam off if NBODY_MOVE is set.
+ */
+typedef struct
+{
+	uint8_t x;
+	uint8_t y;
+	uint8_t flags;
+} nbody_vertex_t;
+
+#define NBODY_MOVE	0x01
+
+
+/** Maps the simulation to the screen */
+typedef struct
+{
+	double cx; // world position at the centre of the screen
+	double cy;
+	double scale; // pixels per world unit
+} nbody_view_t;
+
+
+/** Create a simulation for up to capacity bodies.
+ * Each body keeps the last trail_len positions, one every trail_every
+ * steps; trail_len can be 0.  threads includes the calling thread.
+ */
+extern nbody_t *
+nbody_create(
+	unsigned capacity,
+	unsigned trail_len,
+	unsigned trail_every,
+	unsigned threads
+);
+
+
+extern void
+nbody_free(
+	nbody_t * nb
+);
+
+
+/** Time step, gravitational constant, softening length and the
+ * Barnes-Hut opening angle.  A node is treated as a single mass
+ * when its size is less than theta times its distance.
+ */
+extern void
+nbody_params(
+	nbody_t * nb,
+	double dt,
+	double g,
+	double softening,
+	double theta
+);
+
+
+/** Returns the index of the new body, or -1 if full */
+extern int
+nbody_add(
+	nbody_t * nb,
+	double x,
+	double y,
+	double vx,
+	double vy,
+	double m
+);
+
+
+extern unsigned
+nbody_count(
+	const nbody_t * nb
+);
+
+
+/** Advance one step with the kick-drift-kick leapfrog */
+extern void
+nbody_step(
+	nbody_t * nb
+);
+
+
+/** Kinetic plus potential energy, by direct summation */
+extern double
+nbody_energy(
+	const nbody_t * nb
+);
+
+
+/** Statistics for the last step */
+typedef struct
+{
+	uint64_t interactions; // body-body and body-node
+	unsigned nodes;
+	double build_ns;
+	double force_ns;
+} nbody_stats_t;
+
+extern const nbody_stats_t *
+nbody_stats(
+	const nbody_t * nb
+);
+
+
+/** Fill a display list with each body as a point and its trail as a
+ * polyline.  Anything off the screen is skipped.  Returns the number
+ * of vertices, at most max.
+ */
+extern size_t
+nbody_display(
+	const nbody_t * nb,
+	const nbody_view_t * view,
+	nbody_vertex_t * list,
+	size_t max
+);
+
+
+#endif
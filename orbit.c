@@ -0,0 +1,275 @@
+/** \file
+ * Fixed point leapfrog integrator for orbits around the sun.
+ *
+ * The acceleration is computed directly as the vector to the sun
+ * times G M / r^3, with no trigonometry.  r^-3 comes from a table of
+ * (r^2)^-3/2 over one factor of four of r^2, linearly interpolated,
+ * with r^2 normalized into the table's range by shifting out pairs of
+ * bits.  Every shift by two of r^2 is a shift by three of r^3.
+ *
+ * r^2 is computed from the distances reduced to 15 bits, rounded,
+ * but the full distances are scaled by the table value so that the
+ * direction to the sun is exact.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include "orbit.h"
+#include "memspaces.h"
+
+/** Closer than 1/16 AU is inside the sun; r^2 == 2^14 * 4^17 */
+#define ORBIT_MIN_EXP	17
+
+/** G M / r^3 over r^2 == 512 * (32 to 128), in velocity units per
+ * step per 2^35 position units:
+ * perl -e '$k = 6.67384e-11 * 1.989e30 * 3600**2 / (149e9 / 2**28)**3 / 2**20 / 2**7; printf "%d,\n", $k * ($_ * 512)**-1.5 + 0.5 for 32..128'
+ */
+static const uint16_t PROGMEM gravity_table[] = {
+	35739,
+	34126,
+	32632,
+	31243,
+	29951,
+	28745,
+	27618,
+	26562,
+	25572,
+	24643,
+	23768,
+	22943,
+	22166,
+	21431,
+	20736,
+	20078,
+	19454,
+	18861,
+	18298,
+	17763,
+	17253,
+	16767,
+	16303,
+	15861,
+	15438,
+	15033,
+	14646,
+	14275,
+	13920,
+	13579,
+	13252,
+	12938,
+	12635,
+	12345,
+	12066,
+	11796,
+	11537,
+	11287,
+	11046,
+	10814,
+	10589,
+	10372,
+	10163,
+	9960,
+	9764,
+	9575,
+	9391,
+	9213,
+	9041,
+	8874,
+	8712,
+	8555,
+	8403,
+	8255,
+	8112,
+	7972,
+	7837,
+	7705,
+	7577,
+	7452,
+	7331,
+	7213,
+	7099,
+	6987,
+	6878,
+	6772,
+	6668,
+	6568,
+	6469,
+	6374,
+	6280,
+	6189,
+	6100,
+	6013,
+	5928,
+	5845,
+	5764,
+	5685,
+	5608,
+	5532,
+	5458,
+	5386,
+	5315,
+	5246,
+	5178,
+	5112,
+	5047,
+	4984,
+	4921,
+	4861,
+	4801,
+	4742,
+	4685,
+	4629,
+	4574,
+	4520,
+	4467,
+};
+
+
+/** Scale a distance by the interpolated table value.
+ * d * g needs up to 47 bits, so it is split into the bits above and
+ * below s to keep the products in 32 bits.
+ */
+static int32_t
+orbit_scale(
+	const int32_t d,
+	const uint16_t g,
+	const uint8_t s,
+	const uint8_t shift
+)
+{
+	const uint32_t u = labs(d);
+	const uint32_t hi = (u >> s) * g;
+	const uint32_t lo = ((u & ((1UL << s) - 1)) * g) >> s;
+	const int32_t a = (hi + lo + (1UL << (shift - 1))) >> shift;
+
+	return d < 0 ? -a : a;
+}
+
+
+void
+orbit_accel(
+	int32_t x,
+	int32_t y,
+	int32_t * const ax,
+	int32_t * const ay
+)
+{
+	// Vector towards the sun at (0,0)
+	const int32_t dx = -x;
+	const int32_t dy = -y;
+	const uint32_t ux = labs(dx);
+	const uint32_t uy = labs(dy);
+
+	// Reduce the distances just enough for r^2 to fit in 32 bits
+	uint32_t m = ux | uy;
+	uint8_t s = 0;
+	while (m >= (1UL << 15))
+	{
+		m >>= 1;
+		s++;
+	}
+
+	const uint32_t half = (1UL << s) >> 1;
+	const uint32_t rx = (ux + half) >> s;
+	const uint32_t ry = (uy + half) >> s;
+
+	// Normalize r^2 into [2^14,2^16); r^2 == n * 4^e
+	uint32_t n = rx * rx + ry * ry;
+	uint8_t e = s;
+	while (n >= (1UL << 16))
+	{
+		n >>= 2;
+		e++;
+	}
+
+	if (e < ORBIT_MIN_EXP)
+	{
+		n = 1UL << 14;
+		e = ORBIT_MIN_EXP;
+	}
+
+	const uint8_t i = (n >> 9) - 32;
+	const uint16_t frac = n & 511;
+	const uint16_t g0 = pgm_read_word(&gravity_table[i + 0]);
+	const uint16_t g1 = pgm_read_word(&gravity_table[i + 1]);
+	const uint16_t g = g0 - (((uint32_t) (g0 - g1) * frac) >> 9);
+
+	// r^-3 == g * 2^(35 - 3e)
+	const uint8_t shift = 3 * e - 35 - s;
+	*ax = orbit_scale(dx, g, s, shift);
+	*ay = orbit_scale(dy, g, s, shift);
+}
+
+
+void
+orbit_start(
+	orbit_t * const o
+)
+{
+	int32_t ax;
+	int32_t ay;
+
+	orbit_accel(o->x, o->y, &ax, &ay);
+	o->vx += ax / 2;
+	o->vy += ay / 2;
+}
+
+
+void
+orbit_step(
+	orbit_t * const o
+)
+{
+	const int32_t round = 1L << (ORBIT_VEL_FRAC - 1);
+	int32_t ax;
+	int32_t ay;
+
+	// drift a whole step at the half step velocity
+	o->x += (o->vx + round) >> ORBIT_VEL_FRAC;
+	o->y += (o->vy + round) >> ORBIT_VEL_FRAC;
+
+	// and kick to the next half step
+	orbit_accel(o->x, o->y, &ax, &ay);
+	o->vx += ax;
+	o->vy += ay;
+}
+
+
+void
+orbit_kepler(
+	orbit_t * const o,
+	const kepler_t * const k,
+	const uint32_t sec,
+	const uint16_t ms
+)
+{
+	// wraps around once per orbit
+	const uint32_t m = k->phase + sec * k->rate + ms * k->rate_ms;
+
+	// the second half of the orbit mirrors the first
+	const uint8_t mirror = m >> 31;
+	const uint32_t h = mirror ? -m : m;
+
+	// 2^31 is half an orbit, 2^26 is one of the 32 steps
+	uint8_t i = h >> 26;
+	uint16_t frac = (h >> 18) & 0xFF;
+	if (i == KEPLER_STEPS)
+	{
+		i--;
+		frac = 0x100;
+	}
+
+	const kepler_point_t * const p = &k->table[i];
+	const int16_t x0 = pgm_read_word(&p[0].x);
+	const int16_t y0 = pgm_read_word(&p[0].y);
+	const int16_t x1 = pgm_read_word(&p[1].x);
+	const int16_t y1 = pgm_read_word(&p[1].y);
+
+	const int16_t x = x0 + (((int32_t) (x1 - x0) * frac) >> 8);
+	int16_t y = y0 + (((int32_t) (y1 - y0) * frac) >> 8);
+	if (mirror)
+		y = -y;
+
+	// 2^-14 AU times Q14 is 2^-28 AU, the orbit units
+	o->x = (int32_t) x * k->cos_w - (int32_t) y * k->sin_w;
+	o->y = (int32_t) x * k->sin_w + (int32_t) y * k->cos_w;
+}
@@ -0,0 +1,120 @@
+/** \file
+ * Fixed point orbits around the sun.
+ *
+ * Positions are in units of 2^-28 AU, with the sun at the origin, and
+ * stay exact up to 4 AU out.  Velocities are in the same units per
+ * step, with ORBIT_VEL_FRAC bits of fraction.  Each step is
+ * ORBIT_DT seconds.
+ *
+ * The leapfrog integrator keeps the velocity half a step ahead of the
+ * position, so each step is one kick and one drift with no rounding
+ * of either by half.  It is symplectic, so the orbital energy wobbles
+ * but does not drift away the way it does with Euler steps.
+ */
+#ifndef _orbit_h_
+#define _orbit_h_
+
+#include <stdint.h>
+
+#define ORBIT_AU	149e9 // m
+#define ORBIT_AU_BITS	28
+#define ORBIT_VEL_FRAC	8
+#define ORBIT_DT	3600.0 // s, one hour
+
+/** Convert metres and metres per second to orbit units.
+ * These are constant expressions for use in initializers.
+ */
+#define ORBIT_POS(m) \
+	((int32_t) ((m) / ORBIT_AU * (1L << ORBIT_AU_BITS)))
+
+#define ORBIT_VEL(m_s) \
+	((int32_t) ((m_s) * ORBIT_DT / ORBIT_AU * (1L << ORBIT_AU_BITS) * (1 << ORBIT_VEL_FRAC)))
+
+
+typedef struct
+{
+	int32_t x;
+	int32_t y;
+	int32_t vx; // half a step ahead once started
+	int32_t vy;
+} orbit_t;
+
+
+/** Acceleration towards the sun, in velocity units per step */
+extern void
+orbit_accel(
+	int32_t x,
+	int32_t y,
+	int32_t * ax,
+	int32_t * ay
+);
+
+
+/** Move the velocity from the start time to half a step later.
+ * Call once before the first orbit_step().
+ */
+extern void
+orbit_start(
+	orbit_t * o
+);
+
+
+extern void
+orbit_step(
+	orbit_t * o
+);
+
+
+/** Kepler orbits for showing the planets without integrating them.
+ *
+ * The table holds half an orbit of positions at even steps of mean
+ * anomaly, in 2^-14 AU, with the perihelion on +x and the planet
+ * moving towards +y.  The other half is the mirror image.  It is
+ * rotated to the longitude of the perihelion, given as Q14 cos and
+ * sin, so each position costs a lookup and a few multiplies.
+ */
+#define KEPLER_STEPS	32
+
+/** Mean anomalies are 2^32 per orbit */
+#define KEPLER_ANGLE(deg) \
+	((uint32_t) ((deg) / 360.0 * 4294967296.0))
+
+/** Mean anomaly per second of clock time, with the orbits sped up
+ * by the given number of days per second.  A rate per ms on its own
+ * would lose up to a whole unit per ms, or a tenth of an orbit a day.
+ */
+#define KEPLER_RATE(period_days, days_per_sec) \
+	((uint32_t) (4294967296.0 * (days_per_sec) / (period_days)))
+
+
+typedef struct
+{
+	int16_t x;
+	int16_t y;
+} kepler_point_t;
+
+
+typedef struct
+{
+	const kepler_point_t * table; // in program memory
+	uint32_t phase; // mean anomaly at time 0
+	uint32_t rate; // per second
+	uint32_t rate_ms; // rate / 1000
+	int16_t cos_w; // longitude of the perihelion, Q14
+	int16_t sin_w;
+} kepler_t;
+
+
+/** Set the position of an orbit to where it is at a time after
+ * time 0.  The velocity is not updated.
+ */
+extern void
+orbit_kepler(
+	orbit_t * o,
+	const kepler_t * k,
+	uint32_t sec,
+	uint16_t ms
+);
+
+
+#endif
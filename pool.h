@@ -0,0 +1,159 @@
+/** \file
+ * Fixed capacity entity pool with stable handles.
+ *
+ * The entities themselves live in dense arrays owned by the caller;
+ * the first count entries are live.  The pool keeps a table of ids
+ * that map to the current dense index of each entity, so that a
+ * handle stays valid while other entities are removed and moved
+ * around.  Free ids are kept in a list threaded through the same
+ * table, which makes allocating and freeing O(1).  Each id has a
+ * generation counter that is bumped when it is freed, so a stale
+ * handle to a dead entity is detected instead of finding whatever
+ * reused the slot.
+ *
+ * Define POOL_WIDE before including this for pools of more than
+ * 254 entries.
+ */
+#ifndef _pool_h_
+#define _pool_h_
+
+#include <stdint.h>
+
+#ifdef POOL_WIDE
+typedef uint16_t slot_t;
+#else
+typedef uint8_t slot_t;
+#endif
+
+#define SLOT_NONE	((slot_t) ~0)
+
+
+typedef struct
+{
+	uint8_t gen;
+	slot_t index; // dense index if live, otherwise the next free id
+} pool_entry_t;
+
+
+typedef struct
+{
+	slot_t id;
+	uint8_t gen;
+} handle_t;
+
+
+typedef struct
+{
+	slot_t count;
+	slot_t capacity;
+	slot_t free;
+	uint8_t exhausted; // failed allocations, cleared by the owner
+	pool_entry_t * entry;
+	slot_t * id; // id of each dense entry
+} pool_t;
+
+
+/** Empty the pool and set every generation to zero.
+ * The entry table does not need to be initialised beforehand; handles
+ * taken before the pool was emptied must not be used afterwards.
+ */
+static inline void
+pool_init(
+	pool_t * const p,
+	pool_entry_t * const entry,
+	slot_t * const id,
+	const slot_t capacity
+)
+{
+	p->count = 0;
+	p->capacity = capacity;
+	p->free = 0;
+	p->exhausted = 0;
+	p->entry = entry;
+	p->id = id;
+
+	for (slot_t i = 0 ; i < capacity ; i++)
+	{
+		entry[i].gen = 0;
+		entry[i].index = i + 1 == capacity ? SLOT_NONE : i + 1;
+	}
+}
+
+
+/** Allocate the next dense index.
+ * Returns SLOT_NONE and counts the failure if the pool is full.
+ */
+static inline slot_t
+pool_alloc(
+	pool_t * const p
+)
+{
+	const slot_t id = p->free;
+	if (id == SLOT_NONE)
+	{
+		if (p->exhausted != 0xFF)
+			p->exhausted++;
+		return SLOT_NONE;
+	}
+
+	const slot_t i = p->count++;
+	p->free = p->entry[id].index;
+	p->entry[id].index = i;
+	p->id[i] = id;
+
+	return i;
+}
+
+
+/** Free dense index i.
+ * The last entry takes its place; the caller must move the entity
+ * fields from the returned index to i.
+ */
+static inline slot_t
+pool_free(
+	pool_t * const p,
+	const slot_t i
+)
+{
+	const slot_t id = p->id[i];
+	const slot_t last = --p->count;
+
+	p->entry[id].gen++;
+	p->entry[id].index = p->free;
+	p->free = id;
+
+	if (i != last)
+	{
+		const slot_t moved = p->id[last];
+		p->id[i] = moved;
+		p->entry[moved].index = i;
+	}
+
+	return last;
+}
+
+
+static inline handle_t
+pool_handle(
+	const pool_t * const p,
+	const slot_t i
+)
+{
+	const slot_t id = p->id[i];
+	return (handle_t) { id, p->entry[id].gen };
+}
+
+
+/** Find the dense index of a handle, or SLOT_NONE if it is stale */
+static inline slot_t
+pool_lookup(
+	const pool_t * const p,
+	const handle_t h
+)
+{
+	if (h.id >= p->capacity || p->entry[h.id].gen != h.gen)
+		return SLOT_NONE;
+	return p->entry[h.id].index;
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include "usb_serial.h"
 #include "bits.h"
 #include "sin_table.h"
+#include "fixmath.h"
 #include "vector.h"
 #include "clock.h"
 
@@ -21,6 +22,8 @@
 void send_str(const char *s);
 uint8_t recv_str(char *buf, uint8_t size);
 void parse_and_execute_command(const char *buf, uint8_t num);
+void planet_loop(void);
+void planet_command(uint8_t c);
 
 static uint8_t
 hexdigit(
@@ -133,16 +136,35 @@ draw_str(
 }
 
 
+/** Point on the clock face at a radius and an angle clockwise from
+ * the top, the same way round as sin_lookup().  The angle is rounded
+ * down to the 256 steps to the turn of sin_lookup(), so that the hands
+ * still tick from one step to the next.
+ */
+static void
+face_point(
+	uint16_t angle,
+	uint8_t r,
+	uint8_t * x,
+	uint8_t * y
+)
+{
+	angle &= 0xFF00;
+	*x = 128 + (int16_t) (((int32_t) fix_sin(angle) * r + FIX_ONE / 2) >> FIX_SHIFT);
+	*y = 128 + (int16_t) (((int32_t) fix_cos(angle) * r + FIX_ONE / 2) >> FIX_SHIFT);
+}
+
+
 static void
 analog_clock(void)
 {
+	uint8_t x;
+	uint8_t y;
+
 	// Draw all the digits around the outside
 	for (uint8_t h = 0 ; h < 24 ; h += 6)
 	{
-		uint16_t h2 = h;
-		h2 = (h2 * 682) / 64;
-		uint8_t x = sin_lookup(h2) * 7 / 8 + 128;
-		uint8_t y = cos_lookup(h2) * 7 / 8 + 128;
+		face_point(((uint32_t) h << 16) / 24, 111, &x, &y);
 		draw_char_small(x-8, y-4, h / 10 + '0');
 		draw_char_small(x+2, y-4, h % 10 + '0');
 	}
@@ -170,33 +192,27 @@ analog_clock(void)
 	draw_str(0, 130, "YZ0123456789");
 	
 
+	// the hands are 3/8, 5/8 and 6/8 of the old 127 radius
 	{
-		uint16_t h2 = h;
-		h2 = (h2 * 682 + m*11) / 64;
-		uint8_t hx = sin_lookup(h2) * 3 / 8 + 128;
-		uint8_t hy = cos_lookup(h2) * 3 / 8 + 128;
-		line(128, 128, hx, hy);
+		const uint16_t min_of_day = h * 60 + m;
+		face_point(((uint32_t) min_of_day << 16) / 1440, 48, &x, &y);
+		line(128, 128, x, y);
 	}
 
 
 	{
-		uint16_t m2 = m;
-		m2 = (m2 * 273 + s*4) / 64;
-		uint8_t mx = sin_lookup(m2) * 5 / 8 + 128;
-		uint8_t my = cos_lookup(m2) * 5 / 8 + 128;
-		line(128, 128, mx, my);
-		line_horiz(mx - 5, my, 10);
-		line_vert(mx, my - 5, 10);
+		const uint16_t sec_of_hour = m * 60 + s;
+		face_point(((uint32_t) sec_of_hour << 16) / 3600, 79, &x, &y);
+		line(128, 128, x, y);
+		line_horiz(x - 5, y, 10);
+		line_vert(x, y - 5, 10);
 	}
 
 
-	// seconds to "degrees" = 
 	{
-		uint16_t s2 = s;
-		s2 = (s2 * 1092 + ms) / 256;
-		uint8_t sx = sin_lookup(s2) * 6 / 8 + 128;
-		uint8_t sy = cos_lookup(s2) * 6 / 8 + 128;
-		line(128, 128, sx, sy);
+		const uint16_t ms_of_min = s * 1000 + ms;
+		face_point(((uint32_t) ms_of_min << 16) / 60000, 95, &x, &y);
+		line(128, 128, x, y);
 	}
 
 /*
@@ -249,9 +265,20 @@ int main(void)
 
 	clock_init();
 
+	uint8_t planets = 0;
+
 	while (1)
 	{
-		if (0)
+		// 'p' switches between the clock and the planets, which
+		// take the other keys to zoom and pan the view
+		const int16_t c = usb_serial_getchar();
+		if (c == 'p')
+			planets = !planets;
+		else
+		if (c != -1 && planets)
+			planet_command(c);
+
+		if (planets)
 		{
 			planet_loop();
 			draw_hms(64, now_min*4);
@@ -1,6 +1,10 @@
 /** \file
  * Approximate sin function.
  * theta goes from 0 == 0 Pi to 255 == 2 Pi
+ *
+ * This is only good to about one percent; fixmath.h has a 16-bit
+ * version.  spacerocks keeps using this one so that recorded games
+ * still replay the same.
  */
 #ifndef _sin_table_h_
 #define _sin_table_h_
@@ -0,0 +1,279 @@
+/** \file
+ * Host benchmark for the spacerocks collision broadphase.
+ *
+ *	make spacerocks-bench
+ *	./spacerocks-bench
+ *
+ * The game is built with a much larger playfield population than the
+ * AVR can hold.  For each rock count the rocks and bullets are kept
+ * topped up while rocks_update() runs, and the time per frame is
+ * compared to checking every rock against every bullet, as the AVR
+ * build does.  Both must find the same hits.
+ *
+ * The second table compares moving the rocks in the dense arrays
+ * with the old array of structs, half full of dead slots.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#define MAX_ROCKS	1024
+#define MAX_BULLETS	256
+#define GRID_BITS	5
+#define SPACEROCKS_NO_MAIN
+#include "spacerocks.c"
+
+#define FRAMES		1000
+
+
+/** rocks_update() as the AVR builds it, without GRID_BITS */
+static void
+rocks_update_brute(
+	game_t * const g
+)
+{
+	ship_t * const s = &g->s;
+	rocks_t * const r = &g->r;
+	bullets_t * const b = &g->b;
+
+	for (slot_t i = 0 ; i < r->pool.count ; i++)
+	{
+		r->x[i] += r->vx[i];
+		r->y[i] += r->vy[i];
+	}
+
+	for (slot_t i = 0 ; i < r->pool.count ; )
+	{
+		const slot_t hit = bullet_collide(g, i);
+
+		if (hit == SLOT_NONE)
+		{
+			if (collide(r->x[i] - s->p.x, r->y[i] - s->p.y, r->size[i]))
+				s->dead = 1;
+			i++;
+			continue;
+		}
+
+		uint16_t new_size = r->size[i] / 2;
+		if (new_size > 1024)
+		{
+			rock_create(r, r->x[i], r->y[i], new_size);
+			rock_create(r, r->x[i], r->y[i], new_size);
+			rock_create(r, r->x[i], r->y[i], new_size);
+		}
+
+		rock_remove(r, i);
+		b->age[hit] = 0;
+	}
+
+	for (slot_t j = 0 ; j < b->pool.count ; )
+	{
+		if (b->age[j] == 0)
+			bullet_remove(b, j);
+		else
+			j++;
+	}
+}
+
+
+/** Keep the requested number of rocks and bullets in play */
+static void
+bench_refill(
+	game_t * const g,
+	unsigned rocks,
+	unsigned bullets
+)
+{
+	while (g->r.pool.count < rocks)
+		rock_create(&g->r, fastrand(), fastrand(), (fastrand() % 32) * 256 + 512);
+
+	while (g->b.pool.count < bullets)
+	{
+		const slot_t i = pool_alloc(&g->b.pool);
+		g->b.age[i] = 1 + fastrand() % BULLET_RANGE;
+		g->b.x[i] = fastrand();
+		g->b.y[i] = fastrand();
+		g->b.vx[i] = fastrand() % 2048 - 1024;
+		g->b.vy[i] = fastrand() % 2048 - 1024;
+	}
+}
+
+
+static double
+elapsed_ns(
+	const struct timespec * const start,
+	const struct timespec * const end
+)
+{
+	return (end->tv_sec - start->tv_sec) * 1e9
+		+ (end->tv_nsec - start->tv_nsec);
+}
+
+
+static double
+bench_run(
+	game_t * const g,
+	unsigned rocks,
+	unsigned bullets,
+	void (*update)(game_t *),
+	unsigned * const hits
+)
+{
+	struct timespec start;
+	struct timespec end;
+	double ns = 0;
+
+	game_start(g, rocks);
+	rocks_init(&g->r, 0);
+	*hits = 0;
+
+	for (unsigned frame = 0 ; frame < FRAMES ; frame++)
+	{
+		bench_refill(g, rocks, bullets);
+		g->s.dead = 0;
+
+		const unsigned live = g->b.pool.count;
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		update(g);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		ns += elapsed_ns(&start, &end);
+
+		*hits += live - g->b.pool.count;
+
+		// age the bullets without firing any
+		bullets_update(&g->s, &g->b, 0);
+	}
+
+	return ns / FRAMES;
+}
+
+
+/** The array-of-structs layout that the game used to have */
+typedef struct
+{
+	point_t p;
+	uint8_t type;
+	uint16_t size;
+} rock_aos_t;
+
+
+/** Compare moving half full arrays of structs, where every slot
+ * has to be checked, with moving the dense arrays.
+ */
+static void
+bench_layout(
+	unsigned n
+)
+{
+	static rock_aos_t aos[MAX_ROCKS];
+	static rocks_t soa;
+	struct timespec start;
+	struct timespec end;
+
+	fastsrand(n);
+	pool_init(&soa.pool, soa.entry, soa.id, MAX_ROCKS);
+	for (unsigned i = 0 ; i < MAX_ROCKS ; i++)
+	{
+		aos[i].size = 0;
+		if (i >= 2 * n || (fastrand() & 1))
+			continue;
+		aos[i].size = 512;
+		aos[i].p.vx = fastrand() % ROCK_VEL;
+		aos[i].p.vy = fastrand() % ROCK_VEL;
+		rock_create(&soa, 0, 0, 512);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (unsigned frame = 0 ; frame < FRAMES ; frame++)
+	{
+		for (slot_t i = 0 ; i < 2 * n ; i++)
+		{
+			rock_aos_t * const r = &aos[i];
+			if (r->size == 0)
+				continue;
+			point_update(&r->p);
+		}
+		__asm__ __volatile__("" ::: "memory");
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	const double aos_ns = elapsed_ns(&start, &end) / FRAMES;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (unsigned frame = 0 ; frame < FRAMES ; frame++)
+	{
+		for (slot_t i = 0 ; i < soa.pool.count ; i++)
+		{
+			soa.x[i] += soa.vx[i];
+			soa.y[i] += soa.vy[i];
+		}
+		__asm__ __volatile__("" ::: "memory");
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	const double soa_ns = elapsed_ns(&start, &end) / FRAMES;
+
+	printf("%6u %6u %12.0f %12.0f\n",
+		soa.pool.count,
+		2 * n,
+		aos_ns,
+		soa_ns
+	);
+}
+
+
+int
+main(void)
+{
+	static game_t g;
+
+	printf("%6s %6s %12s %12s %8s %8s\n",
+		"rocks",
+		"bullets",
+		"grid ns",
+		"brute ns",
+		"grid hit",
+		"brute hit"
+	);
+
+	for (unsigned rocks = 8 ; rocks <= MAX_ROCKS / 2 ; rocks *= 2)
+	{
+		unsigned bullets = rocks / 2;
+		if (bullets < 4)
+			bullets = 4;
+		if (bullets > MAX_BULLETS)
+			bullets = MAX_BULLETS;
+
+		unsigned grid_hits;
+		unsigned brute_hits;
+		const double grid_ns = bench_run(&g, rocks, bullets, rocks_update, &grid_hits);
+		const double brute_ns = bench_run(&g, rocks, bullets, rocks_update_brute, &brute_hits);
+
+		printf("%6u %6u %12.0f %12.0f %8u %8u\n",
+			rocks,
+			bullets,
+			grid_ns,
+			brute_ns,
+			grid_hits,
+			brute_hits
+		);
+	}
+
+	const size_t pool_bytes = sizeof(pool_entry_t) + sizeof(slot_t);
+	printf("\n%zu+%zu bytes per rock (was %zu), moving live rocks:\n",
+		(sizeof(rocks_t) - sizeof(pool_t)) / MAX_ROCKS - pool_bytes,
+		pool_bytes,
+		sizeof(rock_aos_t)
+	);
+	printf("%6s %6s %12s %12s\n",
+		"live",
+		"slots",
+		"structs ns",
+		"arrays ns"
+	);
+
+	for (unsigned n = 8 ; n <= MAX_ROCKS / 2 ; n *= 2)
+		bench_layout(n);
+
+	return 0;
+}
@@ -0,0 +1,498 @@
+/** \file
+ * Headless spacerocks simulation harness.
+ *
+ *	make spacerocks-sim
+ *	./spacerocks-sim [-g games] [-j threads] [-t ticks] [-a random|aim] [-s seed]
+ *
+ * Plays thousands of independent games across all cores, with an
+ * autopilot at the controls and nothing drawn.  Each game runs until
+ * the ship dies or the tick limit is reached.  The time taken by every
+ * game_update() is measured, along with the number of rocks, bullets
+ * and collision tests in each tick and any pool exhaustion.
+ *
+ * Every game has its own seed and PRNG, so the results, including the
+ * checksum of how each game ended, do not depend on the number of
+ * threads.  A physics change that should not change the games can be
+ * checked by comparing the checksum before and after.
+ *
+ * The games are split evenly between the worker threads.  A worker
+ * that runs out steals the back half of the remaining games from the
+ * worker with the most left, so short and long games balance out.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "xorshift.h"
+
+/** Each thread plays its games with its own generator */
+static __thread xorshift_t sim_rng;
+
+#define SPACEROCKS_RNG sim_rng
+#define SPACEROCKS_NO_MAIN
+#define SPACEROCKS_QUIET
+#include "spacerocks.c"
+
+/** Tick times are binned by powers of two nanoseconds */
+#define SIM_HIST	32
+
+
+typedef enum
+{
+	PILOT_RANDOM,
+	PILOT_AIM,
+} pilot_t;
+
+
+typedef struct
+{
+	uint64_t games;
+	uint64_t deaths;
+	uint64_t ticks;
+	uint64_t tick_ns;
+	uint64_t tick_ns_max;
+	uint64_t tick_hist[SIM_HIST];
+	uint64_t rocks;
+	uint64_t rocks_max;
+	uint64_t bullets;
+	uint64_t bullets_max;
+	uint64_t collide_tests;
+	uint64_t collide_tests_max;
+	uint64_t rocks_exhausted;
+	uint64_t bullets_exhausted;
+	uint64_t steals;
+	uint64_t checksum;
+} sim_stats_t;
+
+
+typedef struct
+{
+	pthread_t thread;
+	pthread_mutex_t lock;
+	unsigned next; // next game to play
+	unsigned end; // one past the last game
+	sim_stats_t stats;
+} worker_t;
+
+
+static worker_t * workers;
+static unsigned num_workers;
+static unsigned max_ticks = 3000;
+static uint32_t base_seed = 1;
+static pilot_t pilot = PILOT_AIM;
+
+
+/** Random controls that are held for a while before changing */
+static void
+pilot_random(
+	const game_t * const g,
+	unsigned short * const rng,
+	input_t * const in
+)
+{
+	(void) g;
+
+	if (nrand48(rng) % 8 != 0)
+		return;
+
+	in->rot = nrand48(rng) % 3 * 8 - 8;
+	in->thrust = nrand48(rng) % 4 == 0 ? 16 : 0;
+	in->fire = nrand48(rng) % 2;
+	in->brake = nrand48(rng) % 32 == 0;
+}
+
+
+/** Turn towards the nearest rock and shoot when lined up */
+static void
+pilot_aim(
+	const game_t * const g,
+	unsigned short * const rng,
+	input_t * const in
+)
+{
+	const ship_t * const s = &g->s;
+	const rocks_t * const r = &g->r;
+	int32_t best = INT32_MAX;
+	int16_t tx = 0;
+	int16_t ty = 0;
+
+	(void) rng;
+
+	for (slot_t i = 0 ; i < r->pool.count ; i++)
+	{
+		const int16_t dx = r->x[i] - s->p.x;
+		const int16_t dy = r->y[i] - s->p.y;
+		const int32_t d = abs(dx) + abs(dy);
+		if (d >= best)
+			continue;
+		best = d;
+		tx = dx;
+		ty = dy;
+	}
+
+	// components of the target across and along the ship's heading
+	const int32_t across = (int32_t) s->ay * tx - (int32_t) s->ax * ty;
+	const int32_t along = (int32_t) s->ax * tx + (int32_t) s->ay * ty;
+	const uint8_t aimed = along > 0 && labs(across) < along / 8;
+
+	in->rot = aimed ? 0 : across > 0 ? 8 : -8;
+	in->thrust = 0;
+	in->fire = aimed && g->b.pool.count < MAX_BULLETS;
+	in->brake = s->p.vx != 0 || s->p.vy != 0;
+}
+
+
+static double
+elapsed_ns(
+	const struct timespec * const start,
+	const struct timespec * const end
+)
+{
+	return (end->tv_sec - start->tv_sec) * 1e9
+		+ (end->tv_nsec - start->tv_nsec);
+}
+
+
+static inline void
+stat_max(
+	uint64_t * const max,
+	const uint64_t x
+)
+{
+	if (*max < x)
+		*max = x;
+}
+
+
+static void
+sim_play(
+	sim_stats_t * const st,
+	const unsigned id
+)
+{
+	game_t g;
+	input_t in = { 0 };
+	struct timespec start;
+	struct timespec end;
+	const uint32_t seed = base_seed + id;
+	unsigned short rng[3] = { id, seed, seed >> 16 };
+	unsigned tick;
+
+	game_start(&g, seed);
+
+	for (tick = 0 ; tick < max_ticks && !g.s.dead ; tick++)
+	{
+		if (pilot == PILOT_AIM)
+			pilot_aim(&g, rng, &in);
+		else
+			pilot_random(&g, rng, &in);
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		game_update(&g, &in);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		const uint64_t ns = elapsed_ns(&start, &end);
+		unsigned bucket = 0;
+		while (bucket < SIM_HIST - 1 && (ns >> bucket) > 1)
+			bucket++;
+
+		st->tick_ns += ns;
+		stat_max(&st->tick_ns_max, ns);
+		st->tick_hist[bucket]++;
+
+		st->rocks += g.r.pool.count;
+		stat_max(&st->rocks_max, g.r.pool.count);
+		st->bullets += g.b.pool.count;
+		stat_max(&st->bullets_max, g.b.pool.count);
+		st->collide_tests += g.stats.collide_tests;
+		stat_max(&st->collide_tests_max, g.stats.collide_tests);
+		st->rocks_exhausted += g.stats.rocks_exhausted;
+		st->bullets_exhausted += g.stats.bullets_exhausted;
+	}
+
+	st->games++;
+	st->deaths += g.s.dead;
+	st->ticks += tick;
+
+	// mix how the game ended; summed so the order does not matter
+	uint64_t h = ((uint64_t) id << 32)
+		^ ((uint64_t) tick << 16)
+		^ ((uint64_t) g.r.pool.count << 8)
+		^ g.s.ammo
+		^ ((uint64_t)(uint16_t) g.s.p.x << 40)
+		^ ((uint64_t)(uint16_t) g.s.p.y << 48);
+	h ^= h >> 29;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	h ^= h >> 32;
+	st->checksum += h;
+}
+
+
+/** Take the next game from a worker's own queue */
+static int
+work_take(
+	worker_t * const w,
+	unsigned * const id
+)
+{
+	int found = 0;
+
+	pthread_mutex_lock(&w->lock);
+	if (w->next < w->end)
+	{
+		*id = w->next++;
+		found = 1;
+	}
+	pthread_mutex_unlock(&w->lock);
+
+	return found;
+}
+
+
+/** Move the back half of the busiest worker's games to this one.
+ * Returns 0 when there is nothing left anywhere.
+ */
+static int
+work_steal(
+	worker_t * const self
+)
+{
+	while (1)
+	{
+		worker_t * victim = NULL;
+		unsigned most = 0;
+
+		for (unsigned i = 0 ; i < num_workers ; i++)
+		{
+			worker_t * const w = &workers[i];
+			if (w == self)
+				continue;
+
+			pthread_mutex_lock(&w->lock);
+			const unsigned left = w->end - w->next;
+			pthread_mutex_unlock(&w->lock);
+
+			if (left <= most)
+				continue;
+			most = left;
+			victim = w;
+		}
+
+		if (!victim)
+			return 0;
+
+		pthread_mutex_lock(&victim->lock);
+		const unsigned left = victim->end - victim->next;
+		const unsigned take = (left + 1) / 2;
+		const unsigned end = victim->end;
+		victim->end -= take;
+		pthread_mutex_unlock(&victim->lock);
+
+		// someone else got there first; look again
+		if (take == 0)
+			continue;
+
+		pthread_mutex_lock(&self->lock);
+		self->next = end - take;
+		self->end = end;
+		pthread_mutex_unlock(&self->lock);
+
+		self->stats.steals++;
+		return 1;
+	}
+}
+
+
+static void *
+worker_main(
+	void * const arg
+)
+{
+	worker_t * const w = arg;
+	unsigned id;
+
+	while (1)
+	{
+		if (work_take(w, &id))
+			sim_play(&w->stats, id);
+		else
+		if (!work_steal(w))
+			break;
+	}
+
+	return NULL;
+}
+
+
+static void
+stats_merge(
+	sim_stats_t * const t,
+	const sim_stats_t * const s
+)
+{
+	t->games += s->games;
+	t->deaths += s->deaths;
+	t->ticks += s->ticks;
+	t->tick_ns += s->tick_ns;
+	stat_max(&t->tick_ns_max, s->tick_ns_max);
+	for (unsigned i = 0 ; i < SIM_HIST ; i++)
+		t->tick_hist[i] += s->tick_hist[i];
+	t->rocks += s->rocks;
+	stat_max(&t->rocks_max, s->rocks_max);
+	t->bullets += s->bullets;
+	stat_max(&t->bullets_max, s->bullets_max);
+	t->collide_tests += s->collide_tests;
+	stat_max(&t->collide_tests_max, s->collide_tests_max);
+	t->rocks_exhausted += s->rocks_exhausted;
+	t->bullets_exhausted += s->bullets_exhausted;
+	t->steals += s->steals;
+	t->checksum += s->checksum;
+}
+
+
+/** Upper bound of the histogram bucket holding the given fraction */
+static uint64_t
+stats_percentile(
+	const sim_stats_t * const st,
+	const double fraction
+)
+{
+	const uint64_t want = st->ticks * fraction;
+	uint64_t seen = 0;
+
+	for (unsigned i = 0 ; i < SIM_HIST ; i++)
+	{
+		seen += st->tick_hist[i];
+		if (seen > want)
+			return 2ULL << i;
+	}
+
+	return st->tick_ns_max;
+}
+
+
+static void
+usage(
+	const char * const prog
+)
+{
+	fprintf(stderr,
+		"usage: %s [-g games] [-j threads] [-t ticks] [-a random|aim] [-s seed]\n",
+		prog
+	);
+	exit(1);
+}
+
+
+int
+main(
+	int argc,
+	char ** argv
+)
+{
+	unsigned games = 4096;
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	int opt;
+
+	num_workers = cpus > 0 ? cpus : 1;
+
+	while ((opt = getopt(argc, argv, "g:j:t:a:s:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'g': games = strtoul(optarg, NULL, 0); break;
+		case 'j': num_workers = strtoul(optarg, NULL, 0); break;
+		case 't': max_ticks = strtoul(optarg, NULL, 0); break;
+		case 's': base_seed = strtoul(optarg, NULL, 0); break;
+		case 'a':
+			if (strcmp(optarg, "aim") == 0)
+				pilot = PILOT_AIM;
+			else
+			if (strcmp(optarg, "random") == 0)
+				pilot = PILOT_RANDOM;
+			else
+				usage(argv[0]);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+
+	if (num_workers == 0)
+		usage(argv[0]);
+
+	workers = calloc(num_workers, sizeof(*workers));
+	if (!workers)
+	{
+		perror("calloc");
+		return 1;
+	}
+
+	struct timespec start;
+	struct timespec end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (unsigned i = 0 ; i < num_workers ; i++)
+	{
+		worker_t * const w = &workers[i];
+		pthread_mutex_init(&w->lock, NULL);
+		w->next = (uint64_t) games * i / num_workers;
+		w->end = (uint64_t) games * (i + 1) / num_workers;
+	}
+
+	for (unsigned i = 0 ; i < num_workers ; i++)
+	{
+		if (pthread_create(&workers[i].thread, NULL, worker_main, &workers[i]) == 0)
+			continue;
+		perror("pthread_create");
+		return 1;
+	}
+
+	sim_stats_t st = { 0 };
+
+	for (unsigned i = 0 ; i < num_workers ; i++)
+	{
+		pthread_join(workers[i].thread, NULL);
+		stats_merge(&st, &workers[i].stats);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	const double wall = elapsed_ns(&start, &end) / 1e9;
+	const double ticks = st.ticks ? st.ticks : 1;
+
+	printf("%" PRIu64 " games, %u threads, %s autopilot, %.2f s, %" PRIu64 " steals\n",
+		st.games,
+		num_workers,
+		pilot == PILOT_AIM ? "aim" : "random",
+		wall,
+		st.steals
+	);
+	printf("%" PRIu64 " ticks, %.0f ticks/s, %" PRIu64 " deaths, %.0f ticks per game\n",
+		st.ticks,
+		st.ticks / wall,
+		st.deaths,
+		st.ticks / (double) (st.games ? st.games : 1)
+	);
+	printf("tick ns: mean %.0f p50 <%" PRIu64 " p99 <%" PRIu64 " max %" PRIu64 "\n",
+		st.tick_ns / ticks,
+		stats_percentile(&st, 0.50),
+		stats_percentile(&st, 0.99),
+		st.tick_ns_max
+	);
+	printf("%12s %10s %10s\n", "per tick", "mean", "max");
+	printf("%12s %10.2f %10" PRIu64 "\n", "rocks", st.rocks / ticks, st.rocks_max);
+	printf("%12s %10.2f %10" PRIu64 "\n", "bullets", st.bullets / ticks, st.bullets_max);
+	printf("%12s %10.2f %10" PRIu64 "\n", "collide", st.collide_tests / ticks, st.collide_tests_max);
+	printf("pool full: %" PRIu64 " rocks %" PRIu64 " bullets lost\n",
+		st.rocks_exhausted,
+		st.bullets_exhausted
+	);
+	printf("checksum %016" PRIx64 "\n", st.checksum);
+
+	return 0;
+}
@@ -7,22 +7,78 @@
 #include <stdlib.h>
 #include <inttypes.h>
 #include "sin_table.h"
+#include "xform.h"
 #include "memspaces.h"
+#include "xorshift.h"
 
-#ifdef __i386__
-#define fastrand() lrand48()
+/** The same generator on the host and the AVR, so that a seed plays
+ * the same game on both.  Harnesses that run several games at once
+ * can define SPACEROCKS_RNG as a thread local state.
+ */
+#ifndef SPACEROCKS_RNG
+static xorshift_t spacerocks_rng;
+#define SPACEROCKS_RNG spacerocks_rng
+#endif
+
+#define fastrand() xorshift16(&SPACEROCKS_RNG)
+#define fastrand_below(n) xorshift_below(&SPACEROCKS_RNG, n)
+#define fastsrand(seed) xorshift_seed(&SPACEROCKS_RNG, seed)
+
+#ifndef __AVR__
+#include <unistd.h>
+
+#ifndef SPACEROCKS_QUIET
+#define debug(...) fprintf(stderr, __VA_ARGS__)
+#else
+#define debug(...) do {} while (0)
+#endif
+
+/** Count collision tests; this costs too much on the AVR */
+#define CONFIG_STATS
+
+/** Input log, if recording with -r */
+static FILE * log_file;
+
+static inline uint8_t
+log_ready(void)
+{
+	return log_file != NULL;
+}
+
+static inline void
+log_write(
+	const uint8_t * const buf,
+	const uint8_t len
+)
+{
+	fwrite(buf, 1, len, log_file);
+}
 #else
 #include <avr/io.h>
 #include "vector.h"
 #include "bits.h"
+#include "clock.h"
 #include "usb_serial.h"
+#include "adc_filter.h"
+
+#define debug(...) do {} while (0)
 
-static inline uint16_t
-fastrand(void)
+/** The input log is streamed to the USB serial port when a host is
+ * listening; games started before then are not recorded.
+ */
+static inline uint8_t
+log_ready(void)
+{
+	return usb_configured();
+}
+
+static inline void
+log_write(
+	const uint8_t * const buf,
+	const uint8_t len
+)
 {
-	uint16_t r = rand();
-	r ^= rand() << 1;
-	return r;
+	usb_serial_write(buf, len);
 }
 
 static inline uint8_t
@@ -42,11 +98,47 @@ hexdigit(
 
 #define STARTING_FUEL 65535
 #define STARTING_AMMO 200
+
+/** The game logic runs at a fixed rate, independent of how long it
+ * takes to draw the frame.  If drawing falls far behind, at most
+ * MAX_CATCHUP ticks are run before the rest are dropped.
+ */
+#define TICK_MS		20
+#define MAX_CATCHUP	4
+
+/** Draw positions between the last two ticks, rather than jumping
+ * by a whole tick's movement when the frame rate is higher.
+ */
+#define CONFIG_INTERPOLATE
+
+#ifndef MAX_ROCKS
 #define MAX_ROCKS	8
+#endif
+#ifndef MAX_BULLETS
 #define MAX_BULLETS	4
+#endif
 #define ROCK_VEL	128
+#define ROCK_POINTS	8
+#define SHIP_POINTS	5
 #define MIN_RADIUS 	10000
 
+/** With the handful of rocks and bullets that the AVR holds, checking
+ * every rock against every bullet is quicker than binning them and
+ * needs no RAM.  Builds with many more objects can define GRID_BITS
+ * to divide the wrapping 16-bit playfield into 1 << GRID_BITS cells
+ * along each axis, so that each rock only checks the bullets near it.
+ */
+#ifdef GRID_BITS
+#define GRID_SIZE	(1 << GRID_BITS)
+#define GRID_SHIFT	(16 - GRID_BITS)
+#endif
+
+
+#if MAX_ROCKS >= 255 || MAX_BULLETS >= 255
+#define POOL_WIDE
+#endif
+#include "pool.h"
+
 
 typedef struct
 {
@@ -65,24 +157,47 @@ typedef struct
 	uint16_t ammo;
 	uint8_t angle;
 	uint8_t dead;
+
+	// rotated by ship_update_angle(), drawing only translates
+	int8_t path[SHIP_POINTS*2];
 } ship_t;
 
+/** Bullets and rocks are stored as dense arrays of their fields.
+ * The first pool.count entries are live; removing one moves the last
+ * entry into its place, so the update loops never skip dead slots.
+ * The pool tracks the moves so handles to entities stay valid.
+ */
 typedef struct
 {
-	point_t p;
-	uint8_t age;
-} bullet_t;
+	pool_t pool;
+	pool_entry_t entry[MAX_BULLETS];
+	slot_t id[MAX_BULLETS];
+	int16_t x[MAX_BULLETS];
+	int16_t y[MAX_BULLETS];
+	int16_t vx[MAX_BULLETS];
+	int16_t vy[MAX_BULLETS];
+	uint8_t age[MAX_BULLETS];
+} bullets_t;
 
 typedef struct
 {
-	point_t p;
-	uint8_t type;
-	uint16_t size;
-} rock_t;
+	pool_t pool;
+	pool_entry_t entry[MAX_ROCKS];
+	slot_t id[MAX_ROCKS];
+	int16_t x[MAX_ROCKS];
+	int16_t y[MAX_ROCKS];
+	int8_t vx[MAX_ROCKS]; // always less than ROCK_VEL
+	int8_t vy[MAX_ROCKS];
+	uint16_t size[MAX_ROCKS];
+
+	// path and flips for rock_outline(), which draw_rock() calls
+	// rather than keeping ROCK_POINTS*2 bytes of outline per rock
+	uint8_t type[MAX_ROCKS];
+} rocks_t;
 
 
 /** There are various types of rocks */
-static const int8_t PROGMEM rock_paths[][8*2] = {
+static const int8_t PROGMEM rock_paths[][ROCK_POINTS*2] = {
 	{
 		-4, -2,
 		-4, +2,
@@ -129,11 +244,38 @@ static const int8_t PROGMEM rock_paths[][8*2] = {
 #define NUM_ROCK_TYPES (sizeof(rock_paths) / sizeof(*rock_paths))
 
 
+#ifdef GRID_BITS
+/** Live bullets binned by position, rebuilt every frame.
+ * Each cell is a linked list through next[].
+ */
+typedef struct
+{
+	slot_t head[GRID_SIZE * GRID_SIZE];
+	slot_t next[MAX_BULLETS];
+} grid_t;
+#endif
+
+
+/** Counters for the last game_update() */
+typedef struct
+{
+	uint8_t rocks_exhausted; // rocks that did not fit in the pool
+	uint8_t bullets_exhausted; // shots with no free bullet
+#ifdef CONFIG_STATS
+	uint32_t collide_tests; // rock against bullet or ship
+#endif
+} game_stats_t;
+
+
 typedef struct
 {
 	ship_t s;
-	bullet_t b[MAX_BULLETS];
-	rock_t r[MAX_ROCKS];
+	bullets_t b;
+	rocks_t r;
+#ifdef GRID_BITS
+	grid_t grid;
+#endif
+	game_stats_t stats;
 } game_t;
 
 
@@ -147,16 +289,32 @@ point_update(
 }
 
 
+/** Move a batch of points by their velocities */
+static void
+points_update(
+	int16_t * const x,
+	int16_t * const y,
+	const int16_t * const vx,
+	const int16_t * const vy,
+	const slot_t n
+)
+{
+	for (slot_t i = 0 ; i < n ; i++)
+	{
+		x[i] += vx[i];
+		y[i] += vy[i];
+	}
+}
+
+
+/** Check if the offset between two objects is inside the box */
 static int
 collide(
-	const point_t * const p,
-	const point_t * const q,
+	const int16_t dx,
+	const int16_t dy,
 	const int16_t radius
 )
 {
-	int16_t dx = p->x - q->x;
-	int16_t dy = p->y - q->y;
-
 	if (-radius < dx && dx < radius
 	&&  -radius < dy && dy < radius)
 		return 1;
@@ -166,6 +324,36 @@ collide(
 }
 
 
+/** Generate the ship vectors, rotated by the current angle.
+ * This only needs to be redone when the angle changes.
+ */
+static void
+ship_update_path(
+	ship_t * const s
+)
+{
+	static const vec2_t shape[SHIP_POINTS] = {
+		{ 0, 0 },
+		{ -6, -6 },
+		{ 0, 12 },
+		{ +6, -6 },
+		{ 0, 0 },
+	};
+
+	// the angle turns clockwise, like sin_lookup()
+	xform_t m;
+	xform_identity(&m);
+	xform_rotate(&m, -((uint16_t) s->angle << 8));
+
+	for (uint8_t i = 0 ; i < SHIP_POINTS ; i++)
+	{
+		const vec2_t p = xform_apply(&m, shape[i]);
+		s->path[2*i+0] = p.x;
+		s->path[2*i+1] = p.y;
+	}
+}
+
+
 static void
 ship_update_angle(
 	ship_t * const s,
@@ -178,6 +366,7 @@ ship_update_angle(
 	s->angle += rot;
 	s->ax = sin_lookup(s->angle);
 	s->ay = cos_lookup(s->angle);
+	ship_update_path(s);
 }
 
 
@@ -202,7 +391,7 @@ ship_update_thrust(
 static void
 ship_fire(
 	ship_t * const s,
-	bullet_t * const b
+	bullets_t * const b
 )
 {
 	if (s->ammo == 0)
@@ -211,15 +400,20 @@ ship_fire(
 #define BULLET_RANGE 32
 #define BULLET_VEL 8
 
-	b->age = BULLET_RANGE;
-	b->p.x = s->p.x;
-	b->p.y = s->p.y;
-	b->p.vx = s->ax * BULLET_VEL + s->p.vx; // in the direction of the ship
-	b->p.vy = s->ay * BULLET_VEL + s->p.vy; // in the direction of the ship
+	const slot_t i = pool_alloc(&b->pool);
+	if (i == SLOT_NONE)
+	{
+		debug("no bullets\n");
+		return;
+	}
+
+	b->age[i] = BULLET_RANGE;
+	b->x[i] = s->p.x;
+	b->y[i] = s->p.y;
+	b->vx[i] = s->ax * BULLET_VEL + s->p.vx; // in the direction of the ship
+	b->vy[i] = s->ay * BULLET_VEL + s->p.vy; // in the direction of the ship
 
-#ifdef __i386__
-	fprintf(stderr, "fire: vx=%d vy=%d\n", b->p.vx, b->p.vy);
-#endif
+	debug("fire: vx=%d vy=%d\n", b->vx[i], b->vy[i]);
 
 	s->ammo--;
 }
@@ -237,85 +431,267 @@ ship_update(
 	point_update(&s->p);
 }
 
-static rock_t *
+/** Build the outline for one of the rock types at a given size.
+ * The low three bits of the type swap and flip the axes, the
+ * rest select the path.
+ */
+static void
+rock_outline(
+	int8_t * const path,
+	const uint8_t type,
+	const uint16_t size
+)
+{
+	const int8_t s = size / 256;
+	const uint8_t swap_xy = type & 1;
+	const uint8_t flip_x = type & 2;
+	const uint8_t flip_y = type & 4;
+	const int8_t * const rp = rock_paths[type >> 3];
+
+	for (uint8_t i = 0 ; i < ROCK_POINTS ; i++)
+	{
+		int8_t rx = pgm_read_byte(&rp[2*i +  swap_xy]);
+		int8_t ry = pgm_read_byte(&rp[2*i + !swap_xy]);
+		int8_t x = (rx * s) / 4;
+		int8_t y = (ry * s) / 4;
+		path[2*i+0] = flip_x ? -x : x;
+		path[2*i+1] = flip_y ? -y : y;
+	}
+}
+
+
+static slot_t
 rock_create(
-	rock_t * const rocks,
+	rocks_t * const r,
 	int16_t x,
 	int16_t y,
 	int16_t size
 )
 {
-	// find a free rock
-	for (uint8_t i = 0 ; i < MAX_ROCKS ; i++)
+	const slot_t i = pool_alloc(&r->pool);
+	if (i == SLOT_NONE)
+		return SLOT_NONE;
+
+	r->size[i] = size;
+	r->x[i] = x;
+	r->y[i] = y;
+	r->vx[i] = fastrand_below(ROCK_VEL);
+	r->vy[i] = fastrand_below(ROCK_VEL);
+	r->type[i] = fastrand_below(NUM_ROCK_TYPES * 8);
+	return i;
+}
+
+
+static void
+rock_remove(
+	rocks_t * const r,
+	const slot_t i
+)
+{
+	const slot_t last = pool_free(&r->pool, i);
+
+	r->x[i] = r->x[last];
+	r->y[i] = r->y[last];
+	r->vx[i] = r->vx[last];
+	r->vy[i] = r->vy[last];
+	r->size[i] = r->size[last];
+	r->type[i] = r->type[last];
+}
+
+
+static void
+bullet_remove(
+	bullets_t * const b,
+	const slot_t i
+)
+{
+	const slot_t last = pool_free(&b->pool, i);
+
+	b->x[i] = b->x[last];
+	b->y[i] = b->y[last];
+	b->vx[i] = b->vx[last];
+	b->vy[i] = b->vy[last];
+	b->age[i] = b->age[last];
+}
+
+
+/** Find a live bullet that hits rock i by checking all of them.
+ * Returns SLOT_NONE if there is no hit.
+ */
+static slot_t
+bullet_collide(
+	game_t * const g,
+	const slot_t i
+)
+{
+	const bullets_t * const b = &g->b;
+	const rocks_t * const r = &g->r;
+
+	for (slot_t j = 0 ; j < b->pool.count ; j++)
 	{
-		rock_t * const r = &rocks[i];
-		if (r->size != 0)
+		// already used up by another rock this frame
+		if (b->age[j] == 0)
 			continue;
-
-		r->size = size;
-		r->p.x = x;
-		r->p.y = y;
-		r->p.vx = fastrand() % ROCK_VEL;
-		r->p.vy = fastrand() % ROCK_VEL;
-		r->type = fastrand() % (NUM_ROCK_TYPES * 8);
-char buf[64];
-buf[0] = hexdigit(i);
-buf[1] = hexdigit(r->p.vx >> 12);
-buf[2] = hexdigit(r->p.vx >>  8);
-buf[3] = hexdigit(r->p.vx >>  4);
-buf[4] = hexdigit(r->p.vx >>  0);
-buf[5] = '\r';
-buf[6] = '\n';
-		if (usb_configured())
-			usb_serial_write(buf, 6);
-		return r;
+#ifdef CONFIG_STATS
+		g->stats.collide_tests++;
+#endif
+		if (collide(r->x[i] - b->x[j], r->y[i] - b->y[j], r->size[i]))
+			return j;
 	}
 
-	return NULL;
+	return SLOT_NONE;
+}
+
+
+#ifdef GRID_BITS
+static inline uint8_t
+grid_cell(
+	int16_t v
+)
+{
+	return (uint16_t) v >> GRID_SHIFT;
 }
 
 
 static void
-rocks_update(
-	ship_t * const s,
-	bullet_t * const bullets,
-	rock_t * const rocks
+grid_build(
+	grid_t * const grid,
+	const bullets_t * const b
 )
 {
-	for (uint8_t i = 0 ; i < MAX_ROCKS ; i++)
+	for (uint16_t i = 0 ; i < GRID_SIZE * GRID_SIZE ; i++)
+		grid->head[i] = SLOT_NONE;
+
+	// backwards, so that each cell lists its bullets in order
+	for (slot_t i = b->pool.count ; i-- > 0 ; )
 	{
-		rock_t * const r = &rocks[i];
-		if (r->size == 0)
-			continue;
+		const uint16_t cell = grid_cell(b->y[i]) * GRID_SIZE
+			+ grid_cell(b->x[i]);
+		grid->next[i] = grid->head[cell];
+		grid->head[cell] = i;
+	}
+}
 
-		point_update(&r->p);
 
-		// check for bullet collision
-		for (uint8_t j = 0 ; j < MAX_BULLETS ; j++)
+/** Find the first live bullet that hits rock i, the same one that
+ * bullet_collide() would, so that the games do not depend on the grid.
+ * Only the grid cells under the rock's bounding box are checked;
+ * the box can wrap around the edge of the playfield like the rock.
+ * Returns SLOT_NONE if there is no hit.
+ */
+static slot_t
+grid_collide(
+	game_t * const g,
+	const slot_t i
+)
+{
+	const grid_t * const grid = &g->grid;
+	const bullets_t * const b = &g->b;
+	const rocks_t * const r = &g->r;
+	const int16_t x = r->x[i];
+	const int16_t y = r->y[i];
+	const uint16_t size = r->size[i];
+	const uint8_t x0 = grid_cell(x - size);
+	const uint8_t y0 = grid_cell(y - size);
+	const uint16_t nx = ((grid_cell(x + size) - x0) & (GRID_SIZE - 1)) + 1;
+	const uint16_t ny = ((grid_cell(y + size) - y0) & (GRID_SIZE - 1)) + 1;
+
+	slot_t hit = SLOT_NONE;
+
+	for (uint16_t dy = 0 ; dy < ny ; dy++)
+	{
+		const uint16_t row = ((y0 + dy) & (GRID_SIZE - 1)) * GRID_SIZE;
+
+		for (uint16_t dx = 0 ; dx < nx ; dx++)
 		{
-			bullet_t * const b = &bullets[j];
-			if (b->age == 0)
-				continue;
-			if (collide(&r->p, &b->p, r->size))
+			slot_t j = grid->head[row + ((x0 + dx) & (GRID_SIZE - 1))];
+
+			// only bullets before the best hit so far can beat it
+			for ( ; j != SLOT_NONE && j < hit ; j = grid->next[j])
 			{
-				uint16_t new_size = r->size / 2;
-				if (new_size > 1024)
+				// already used up by another rock this frame
+				if (b->age[j] == 0)
+					continue;
+#ifdef CONFIG_STATS
+				g->stats.collide_tests++;
+#endif
+				if (collide(x - b->x[j], y - b->y[j], size))
 				{
-					rock_create(rocks, r->p.x, r->p.y, new_size);
-					rock_create(rocks, r->p.x, r->p.y, new_size);
-					rock_create(rocks, r->p.x, r->p.y, new_size);
+					hit = j;
+					break;
 				}
+			}
+		}
+	}
+
+	return hit;
+}
+#endif
 
-				r->size = 0;
-				b->age = 0;
 
-				// stop checking everything
-				return;
-			}
+/** Move the rocks and resolve every collision in this frame.
+ * Each bullet can destroy at most one rock.  The pieces of a split
+ * rock are appended and checked in the same frame, but the bullet
+ * that split it is already gone.  Bullets that hit something are
+ * only removed at the end, since a collision grid holds their indexes.
+ */
+static void
+rocks_update(
+	game_t * const g
+)
+{
+	ship_t * const s = &g->s;
+	rocks_t * const r = &g->r;
+	bullets_t * const b = &g->b;
+
+	for (slot_t i = 0 ; i < r->pool.count ; i++)
+	{
+		r->x[i] += r->vx[i];
+		r->y[i] += r->vy[i];
+	}
+
+#ifdef GRID_BITS
+	grid_build(&g->grid, b);
+#endif
+
+	for (slot_t i = 0 ; i < r->pool.count ; )
+	{
+		// check for bullet collision
+#ifdef GRID_BITS
+		const slot_t j = grid_collide(g, i);
+#else
+		const slot_t j = bullet_collide(g, i);
+#endif
+		if (j == SLOT_NONE)
+		{
+#ifdef CONFIG_STATS
+			g->stats.collide_tests++;
+#endif
+			if (collide(r->x[i] - s->p.x, r->y[i] - s->p.y, r->size[i]))
+				s->dead = 1;
+			i++;
+			continue;
+		}
+
+		uint16_t new_size = r->size[i] / 2;
+		if (new_size > 1024)
+		{
+			rock_create(r, r->x[i], r->y[i], new_size);
+			rock_create(r, r->x[i], r->y[i], new_size);
+			rock_create(r, r->x[i], r->y[i], new_size);
 		}
 
-		 if (collide(&r->p, &s->p, r->size))
-			s->dead = 1;
+		// the last rock moves into this slot and is checked next
+		rock_remove(r, i);
+		b->age[j] = 0;
+	}
+
+	for (slot_t j = 0 ; j < b->pool.count ; )
+	{
+		if (b->age[j] == 0)
+			bullet_remove(b, j);
+		else
+			j++;
 	}
 }
 
@@ -323,32 +699,22 @@ rocks_update(
 static void
 bullets_update(
 	ship_t * const s,
-	bullet_t * const bullets,
+	bullets_t * const b,
 	uint8_t fire
 )
 {
-	for (uint8_t i = 0 ; i < MAX_BULLETS ; i++)
+	for (slot_t i = 0 ; i < b->pool.count ; )
 	{
-		bullet_t * const b = &bullets[i];
-		if (b->age != 0)
-		{
-			b->age--;
-			point_update(&b->p);
-		} else
-		if (fire)
-		{
-			// We can try to fire this one
-			ship_fire(s, b);
-			fire = 0;
-		}
+		if (--b->age[i] == 0)
+			bullet_remove(b, i);
+		else
+			i++;
 	}
 
+	points_update(b->x, b->y, b->vx, b->vy, b->pool.count);
+
 	if (fire)
-	{
-#ifdef __i386__
-		fprintf(stderr, "no bullets\n");
-#endif
-	}
+		ship_fire(s, b);
 }
 
 
@@ -368,41 +734,34 @@ ship_init(
 	s->ammo = STARTING_AMMO;
 	s->ax = sin_lookup(s->angle);
 	s->ay = cos_lookup(s->angle);
+	ship_update_path(s);
 }
 
 
 static void
 bullets_init(
-	bullet_t * const bullets
+	bullets_t * const b
 )
 {
-	for (uint8_t i = 0 ; i < MAX_BULLETS ; i++)
-	{
-		bullet_t * const b = &bullets[i];
-		b->age = 0;
-	}
+	pool_init(&b->pool, b->entry, b->id, MAX_BULLETS);
 }
 
 
 
 static void
 rocks_init(
-	rock_t * const rocks,
-	uint8_t num
+	rocks_t * const rocks,
+	slot_t num
 )
 {
-	for (uint8_t i = 0 ; i < MAX_ROCKS ; i++)
-	{
-		rock_t * const r = &rocks[i];
-		r->size = 0;
-	}
+	pool_init(&rocks->pool, rocks->entry, rocks->id, MAX_ROCKS);
 
-	for (uint8_t i = 0 ; i < num ; i++)
+	for (slot_t i = 0 ; i < num ; i++)
 	{
 		// Make sure that there is space around the center
 		int16_t x = fastrand();
 		int16_t y = fastrand();
-		uint16_t size = (fastrand() % 32) * 256 + 512;
+		uint16_t size = fastrand_below(32) * 256 + 512;
 		if (0 <= x)
 			x += MIN_RADIUS;
 		else
@@ -424,38 +783,165 @@ game_init(
 )
 {
 	ship_init(&g->s);
-	bullets_init(g->b);
-	rocks_init(g->r, 5);
+	bullets_init(&g->b);
+	rocks_init(&g->r, 5);
 }
 
 
+/** Player input for one tick.
+ * Everything that affects the game apart from the PRNG seed comes
+ * through here, so that a game can be recorded and replayed.
+ */
+typedef struct
+{
+	int8_t rot;
+	uint8_t thrust; // 0 to 63
+	uint8_t fire;
+	uint8_t brake;
+} input_t;
+
+
+/** Start a new game from a PRNG seed */
+static void
+game_start(
+	game_t * const g,
+	const uint32_t seed
+)
+{
+	fastsrand(seed);
+	game_init(g);
+}
+
+
+/** Run one tick of the game.
+ * When the ship is destroyed g->s.dead is set and the caller is
+ * expected to start a new game.
+ */
 static void
 game_update(
 	game_t * const g,
-	int8_t rot,
-	uint8_t thrust,
-	uint8_t fire
+	const input_t * const in
 )
 {
-	//printf("rot=%d thrust=%d fire=%d\n", rot, thrust, fire);
+	//printf("rot=%d thrust=%d fire=%d\n", in->rot, in->thrust, in->fire);
+
+#ifdef CONFIG_STATS
+	g->stats.collide_tests = 0;
+#endif
+
+	if (in->brake)
+		g->s.p.vx = g->s.p.vy = 0;
 
 	// Update our position before we fire the gun
-	ship_update(&g->s, rot, thrust);
+	ship_update(&g->s, in->rot, in->thrust);
 
 	// Update our bullets before the rocks move
-	bullets_update(&g->s, g->b, fire);
+	bullets_update(&g->s, &g->b, in->fire);
 
 	// Update the rocks, checking for collisions
-	rocks_update(&g->s, g->b, g->r);
+	rocks_update(g);
+
+	// Nothing is dropped silently when the pools are full
+	g->stats.rocks_exhausted = g->r.pool.exhausted;
+	g->stats.bullets_exhausted = g->b.pool.exhausted;
+	g->r.pool.exhausted = 0;
+	g->b.pool.exhausted = 0;
+}
+
+
+/** The input log.
+ *
+ * Each game starts with a header of 'S', 'R', LOG_VERSION and the
+ * 32-bit PRNG seed, little endian.  It is followed by runs of
+ * identical ticks, three bytes each: the number of ticks (1 to 255),
+ * the rotation and the thrust with the fire and brake flags.  A game
+ * ends when the replayed ship dies, and the next header follows.
+ *
+ * Most ticks repeat the one before, so a minute of play is usually a
+ * few hundred bytes.
+ */
+#define LOG_VERSION	2
+#define LOG_HEADER	7
+#define LOG_RECORD	3
+#define LOG_THRUST	0x3F
+#define LOG_FIRE	0x40
+#define LOG_BRAKE	0x80
+
+typedef struct
+{
+	uint8_t enabled;
+	uint8_t run;
+	int8_t rot;
+	uint8_t flags;
+} recorder_t;
+
+
+static void
+recorder_flush(
+	recorder_t * const rec
+)
+{
+	if (rec->run == 0)
+		return;
+
+	const uint8_t buf[LOG_RECORD] = { rec->run, rec->rot, rec->flags };
+	log_write(buf, sizeof(buf));
+	rec->run = 0;
+}
+
+
+/** Finish the previous game's log and start a new one */
+static void
+recorder_start(
+	recorder_t * const rec,
+	const uint32_t seed
+)
+{
+	recorder_flush(rec);
+
+	rec->enabled = log_ready();
+	if (!rec->enabled)
+		return;
 
-	// If we hit something, start over
-	if (g->s.dead)
+	const uint8_t buf[LOG_HEADER] = {
+		'S', 'R', LOG_VERSION,
+		seed >>  0,
+		seed >>  8,
+		seed >> 16,
+		seed >> 24,
+	};
+	log_write(buf, sizeof(buf));
+}
+
+
+static void
+recorder_tick(
+	recorder_t * const rec,
+	const input_t * const in
+)
+{
+	if (!rec->enabled)
+		return;
+
+	const uint8_t flags = 0
+		| (in->thrust & LOG_THRUST)
+		| (in->fire ? LOG_FIRE : 0)
+		| (in->brake ? LOG_BRAKE : 0)
+		;
+
+	if (rec->run != 0
+	&&  rec->run != 0xFF
+	&&  rec->rot == in->rot
+	&&  rec->flags == flags)
 	{
-#ifdef __i386__
-		fprintf(stderr, "game over\n");
-#endif
-		game_init(g);
+		rec->run++;
+		return;
 	}
+
+	recorder_flush(rec);
+	rec->run = 1;
+	rec->rot = in->rot;
+	rec->flags = flags;
 }
 
 
@@ -501,7 +987,7 @@ draw_path(
 
 		if (do_line)
 		{
-#ifdef __i386__
+#ifndef __AVR__
 			printf("%d %d\n%d %d\n\n", ox8, oy8, px8, py8);
 #else
 			line(ox8, oy8, px8, py8);
@@ -513,34 +999,45 @@ draw_path(
 }
 
 
-#define ROTATE(x,y) \
-	((x) * s->ay + (y) * s->ax) / 128, \
-	((y) * s->ay - (x) * s->ax) / 128 \
-
-/** Generate the ship vectors, rotated by the current angle.
- * The ship_update_rot() has cached the sin/cos value for us.
+/** Convert a position to the screen, moved back towards where it
+ * was on the previous tick.  alpha is the fraction of the current
+ * tick that has elapsed, from 0 to 256.  Objects only move by their
+ * velocity in a tick, so the previous position does not need to be
+ * stored.
  */
+static inline uint8_t
+screen_pos(
+	int16_t x,
+	const int16_t v,
+	const uint16_t alpha
+)
+{
+	x -= ((int32_t) v * (256 - alpha)) >> 8;
+	return x / 256 + 128;
+}
+
+
 static void
 draw_ship(
-	const ship_t * const s
+	const ship_t * const s,
+	const uint16_t alpha
 )
 {
-	int8_t path[] = {
-		ROTATE(0,0),
-		ROTATE(-6, -6),
-		ROTATE(0,12),
-		ROTATE(+6,-6),
-		ROTATE(0,0),
-	};
-
-	draw_path(s->p.x / 256 + 128, s->p.y / 256 + 128, path, 5);
+	draw_path(
+		screen_pos(s->p.x, s->p.vx, alpha),
+		screen_pos(s->p.y, s->p.vy, alpha),
+		s->path,
+		SHIP_POINTS
+	);
 }
 
 
 /** Draw the bullets lined in the direction of travel */
 static void
 draw_bullet(
-	const bullet_t * const b
+	const bullets_t * const b,
+	const slot_t i,
+	const uint16_t alpha
 )
 {
 	int8_t path[] = {
@@ -549,130 +1046,266 @@ draw_bullet(
 		+1, +1,
 		+1, -1,
 		-1, -1,
-		//b->p.vx/64, b->p.vy/64,
+		//b->vx[i]/64, b->vy[i]/64,
 	};
 
-	draw_path(b->p.x / 256 + 128, b->p.y / 256 + 128, path, 5);
+	draw_path(
+		screen_pos(b->x[i], b->vx[i], alpha),
+		screen_pos(b->y[i], b->vy[i], alpha),
+		path,
+		5
+	);
 }
 
 
 
 static void
 draw_rock(
-	const rock_t * const r
+	const rocks_t * const r,
+	const slot_t n,
+	const uint16_t alpha
 )
 {
-	//printf("rock %d,%d size %d\n", r->p.x/256+128, r->p.y/256+128, r->size/256);
+	//printf("rock %d,%d size %d\n", r->x[n]/256+128, r->y[n]/256+128, r->size[n]/256);
 
-	const int8_t s = r->size / 256;
-	const uint8_t swap_xy = r->type & 1;
-	const uint8_t flip_x = r->type & 2;
-	const uint8_t flip_y = r->type & 4;
-	const int8_t * const rp = rock_paths[r->type >> 3];
+	int8_t path[ROCK_POINTS*2];
+	rock_outline(path, r->type[n], r->size[n]);
 
-	int8_t path[8*2];
-	for (uint8_t i = 0 ; i < 8 ; i++)
-	{
-		int8_t rx = pgm_read_byte(&rp[2*i +  swap_xy]);
-		int8_t ry = pgm_read_byte(&rp[2*i + !swap_xy]);
-		int8_t x = (rx * s) / 4;
-		int8_t y = (ry * s) / 4;
-		path[2*i+0] = flip_x ? -x : x;
-		path[2*i+1] = flip_y ? -y : y;
-	}
-
-	draw_path(r->p.x / 256 + 128, r->p.y / 256 + 128, path, 8);
+	draw_path(
+		screen_pos(r->x[n], r->vx[n], alpha),
+		screen_pos(r->y[n], r->vy[n], alpha),
+		path,
+		ROCK_POINTS
+	);
 }
 
 
+/** Draw the game state; pass alpha 256 to draw the latest tick */
 static void
 game_vectors(
-	const game_t * const g
+	const game_t * const g,
+	const uint16_t alpha
+)
+{
+	draw_ship(&g->s, alpha);
+
+	for (slot_t i = 0 ; i < g->r.pool.count ; i++)
+		draw_rock(&g->r, i, alpha);
+
+	for (slot_t i = 0 ; i < g->b.pool.count ; i++)
+		draw_bullet(&g->b, i, alpha);
+}
+
+
+#ifndef __AVR__
+#ifndef SPACEROCKS_NO_MAIN
+/** Reads the input log written by the recorder */
+typedef struct
+{
+	FILE * file;
+	uint8_t run;
+	input_t in;
+} replay_t;
+
+
+/** Read the header of the next game.
+ * Returns 0 at the end of the log, -1 if the game and the log
+ * have diverged.
+ */
+static int
+replay_start(
+	replay_t * const p,
+	uint32_t * const seed
 )
 {
-	draw_ship(&g->s);
+	uint8_t buf[LOG_HEADER];
+	if (fread(buf, 1, sizeof(buf), p->file) != sizeof(buf))
+		return 0;
 
-	for (uint8_t i = 0 ; i < MAX_ROCKS ; i++)
+	if (p->run != 0
+	||  buf[0] != 'S'
+	||  buf[1] != 'R'
+	||  buf[2] != LOG_VERSION)
 	{
-		const rock_t * const r = &g->r[i];
-		if (r->size == 0)
-			continue;
-		draw_rock(r);
+		fprintf(stderr, "replay: log does not match the game\n");
+		return -1;
 	}
 
-	for (uint8_t i = 0 ; i < MAX_BULLETS ; i++)
+	*seed = 0
+		| (uint32_t) buf[3] <<  0
+		| (uint32_t) buf[4] <<  8
+		| (uint32_t) buf[5] << 16
+		| (uint32_t) buf[6] << 24
+		;
+
+	return 1;
+}
+
+
+/** Read the input for the next tick.
+ * Returns 0 at the end of the log.
+ */
+static int
+replay_tick(
+	replay_t * const p,
+	input_t * const in
+)
+{
+	if (p->run == 0)
+	{
+		uint8_t buf[LOG_RECORD];
+		if (fread(buf, 1, sizeof(buf), p->file) != sizeof(buf))
+			return 0;
+
+		p->run = buf[0];
+		p->in.rot = buf[1];
+		p->in.thrust = buf[2] & LOG_THRUST;
+		p->in.fire = (buf[2] & LOG_FIRE) != 0;
+		p->in.brake = (buf[2] & LOG_BRAKE) != 0;
+
+		if (p->run == 0)
+		{
+			fprintf(stderr, "replay: bad record\n");
+			return 0;
+		}
+	}
+
+	p->run--;
+	*in = p->in;
+	return 1;
+}
+
+
+/** Read the next tick's input from the keyboard.
+ * Returns 0 at the end of the input.
+ */
+static int
+keyboard_tick(
+	input_t * const in
+)
+{
+	int c;
+
+	while (1)
 	{
-		const bullet_t * const b = &g->b[i];
-		if (b->age == 0)
+		c = getchar();
+		if (c == '\n')
 			continue;
-		draw_bullet(b);
+		if (c == -1)
+			return 0;
+		break;
 	}
+
+	in->rot = c == 'l' ? -17 : c == 'r' ? +17 : 0;
+	in->thrust = c == 't' ? 16 : 0;
+	in->fire = c == 'f' ? 1 : 0;
+	in->brake = 0;
+
+	return 1;
 }
 
 
-#ifdef __i386__
-int main(void)
+int main(
+	int argc,
+	char ** argv
+)
 {
+	replay_t replay = { NULL, 0 };
+	recorder_t rec = { 0 };
+	int opt;
+
+	while ((opt = getopt(argc, argv, "r:p:")) != -1)
+	{
+		FILE ** const f = opt == 'r' ? &log_file : &replay.file;
+		if (opt != 'r' && opt != 'p')
+		{
+			fprintf(stderr, "usage: %s [-r record.log] [-p replay.log]\n", argv[0]);
+			return 1;
+		}
+
+		*f = fopen(optarg, opt == 'r' ? "wb" : "rb");
+		if (!*f)
+		{
+			perror(optarg);
+			return 1;
+		}
+	}
+
 	srand48(getpid());
+	uint32_t seed = lrand48();
+
+	if (replay.file && replay_start(&replay, &seed) <= 0)
+		return 1;
 
 	game_t g;
 
-	game_init(&g);
+	recorder_start(&rec, seed);
+	game_start(&g, seed);
 
 	while (1)
 	{
 #if 0
 		printf("---\nS: %+6d,%+6d %+6d,%+6d %d\n", g.s.p.x/256, g.s.p.y/256, g.s.p.vx, g.s.p.vy, g.s.angle);
 
-		for (uint8_t i = 0 ; i < MAX_ROCKS ; i++)
-		{
-			const rock_t * const r = &g.r[i];
-			if (r->size == 0)
-				continue;
-			printf("%d: %+6d,%+6d %+6d,%+6d\n", i, r->p.x/256, r->p.y/256, r->p.vx, r->p.vy);
-		}
+		for (slot_t i = 0 ; i < g.r.pool.count ; i++)
+			printf("%d: %+6d,%+6d %+6d,%+6d\n", i, g.r.x[i]/256, g.r.y[i]/256, g.r.vx[i], g.r.vy[i]);
 #else
-		game_vectors(&g);
+		game_vectors(&g, 256);
 #endif
 
-		int c;
+		input_t in;
+		if (replay.file ? !replay_tick(&replay, &in) : !keyboard_tick(&in))
+			break;
 
-		while (1)
-		{
-			c = getchar();
-			if (c == '\n')
-				continue;
-			if (c == -1)
-				return 0;
+		recorder_tick(&rec, &in);
+		game_update(&g, &in);
+
+		if (g.stats.rocks_exhausted || g.stats.bullets_exhausted)
+			fprintf(stderr, "pool full: %d rocks %d bullets lost\n",
+				g.stats.rocks_exhausted,
+				g.stats.bullets_exhausted
+			);
+
+		if (!g.s.dead)
+			continue;
+
+		// If we hit something, start over
+		fprintf(stderr, "game over\n");
+		seed = fastrand();
+		if (replay.file && replay_start(&replay, &seed) < 0)
 			break;
-		}
 
-		game_update(
-			&g,
-			c == 'l' ? -17 : c == 'r' ? +17 : 0,
-			c == 't' ? 16 : 0,
-			c == 'f' ? 1 : 0
-		);
+		recorder_start(&rec, seed);
+		game_start(&g, seed);
 	}
+
+	recorder_flush(&rec);
+	if (log_file)
+		fclose(log_file);
+
+	return 0;
 }
+#endif
 
 #else
 
 /**
  * Enable ADC and select input ADC0 / F0
- * Select high-speed mode, left aligned
- * Use clock divisor of 2
+ * Select high-speed mode, right aligned, free running.
  * System clock is 16 MHz on teensy, 8 MHz on tiny,
  * conversions take 13 ticks, so divisor == 128 (1,1,1) should
- * give 9.6 KHz of samples.
+ * give 9.6 KHz of samples, or 300 filtered readings per second
+ * for each of the two channels.
  */
-static uint8_t adc_input;
+static adc_filter_t adc;
 static uint16_t adc_values[4];
 
 static void
 joy_init(void)
 {
-	ADMUX = adc_input
+	adc_filter_init(&adc);
+
+	ADMUX = adc.mux
 		| (0 << REFS1)
 		| (1 << REFS0)
 		;
@@ -680,14 +1313,19 @@ joy_init(void)
 	ADCSRA = 0
 		| (1 << ADEN) // enable ADC
 		| (0 << ADSC) // don't start yet
-		| (0 << ADIE) // don't enable the interrupts
-		| (0 << ADPS2)
+		| (1 << ADATE) // auto trigger
+		| (1 << ADIE) // interrupt on each conversion
+		| (1 << ADPS2)
 		| (1 << ADPS1)
 		| (1 << ADPS0)
 		;
 
 	ADCSRB = 0
 		| (1 << ADHSM) // enable highspeed mode
+		| (0 << ADTS3) // trigger source free running
+		| (0 << ADTS2)
+		| (0 << ADTS1)
+		| (0 << ADTS0)
 		;
 
 	DDRF = 0;
@@ -697,25 +1335,18 @@ joy_init(void)
 	sbi(DIDR0, ADC0D);
 	sbi(DIDR0, ADC1D);
 
-	// Start the first conversion!
+	// Start the first conversion; the rest follow on their own
 	sbi(ADCSRA, ADSC);
 }
 
 
-static void
-adc_read(void)
+/** Alternate between the joystick axes, filtering each one */
+ISR(ADC_vect)
 {
-	if (bit_is_set(ADCSRA, ADSC))
-		return;
-
-	adc_values[adc_input] = ADC;
-	adc_input = (adc_input + 1) % 2;
-
-	// Configure for the next input
-	ADMUX = (ADMUX & ~0x1F) | adc_input;
-
-	// Start the next conversion
-	sbi(ADCSRA, ADSC);
+	const uint16_t sample = ADC;
+	const uint8_t chan = adc_filter_advance(&adc);
+	ADMUX = (ADMUX & ~0x1F) | adc.mux;
+	adc_filter_sample(&adc, chan, sample);
 }
 
 
@@ -733,32 +1364,65 @@ draw_hex(
 
 
 static game_t g;
+static recorder_t rec;
+
+
+/** Seed each game from when it started and the joystick noise */
+static uint32_t
+game_seed(void)
+{
+	return 0
+		^ ((uint32_t) clock_now() << 16)
+		^ ((uint32_t) adc_values[0] << 6)
+		^ adc_values[1]
+		^ fastrand()
+		;
+}
+
+
+static void
+game_restart(void)
+{
+	const uint32_t seed = game_seed();
+	recorder_start(&rec, seed);
+	game_start(&g, seed);
+}
+
 
 int main(void)
 {
 	// set for 16 MHz clock
 #define CPU_PRESCALE(n) (CLKPR = 0x80, CLKPR = (n))
 	CPU_PRESCALE(0);
-	TCCR0B = 1;
 
 	usb_init();
 	joy_init();
-	game_init(&g);
+	clock_init();
+	game_restart();
 
 	DDRB = 0xFF;
 	DDRD = 0xFF;
 
 	uint8_t last_fire = 0;
+	uint8_t fire_pending = 0;
+	uint16_t pool_lost = 0;
+	uint16_t last_tick = clock_now();
 
 	while (1)
 	{
-		adc_read();
+		adc_filter_read(&adc, adc_values);
 		adc_values[2] = in(0xF4);
 		adc_values[3] = in(0xF5);
 
 		//line_horiz(0,0, 250);
 		//line_vert(0,0, 250);
-		game_vectors(&g);
+		uint16_t alpha = 256;
+#ifdef CONFIG_INTERPOLATE
+		const uint16_t since = clock_now() - last_tick;
+		if (since < TICK_MS)
+			alpha = (since * 256) / TICK_MS;
+#endif
+		game_vectors(&g, alpha);
 
 		draw_char_small( 0, 230, 'F');
 		draw_char_small(20, 230, '=');
@@ -768,6 +1432,13 @@ int main(void)
 		draw_char_small(20, 200, '=');
 		draw_hex(40, 200, g.s.ammo);
 
+		if (pool_lost)
+		{
+			draw_char_small( 0, 170, 'P');
+			draw_char_small(20, 170, '=');
+			draw_hex(40, 170, pool_lost);
+		}
+
 		draw_hex(255-60, 30, adc_values[0]);
 		draw_hex(255-60, 10, adc_values[1]);
 		//draw_hex(0, 80, adc_values[2]);
@@ -780,46 +1451,40 @@ int main(void)
 
 		int c = -1;
 
-		int8_t rot = (adc_values[0] >> 7) - (512 >> 7);
+		input_t in;
+		in.rot = (512 >> 7) - (adc_values[0] >> 7);
 		int8_t thrust = (adc_values[1] >> 3) - (512 >> 3);
-		if (thrust == -64)
-			g.s.p.vx = g.s.p.vy = 0;
-		if (thrust < 0)
-			thrust = 0;
+		in.brake = thrust == -64;
+		in.thrust = thrust < 0 ? 0 : thrust;
 	
+		// Remember a press until the next tick so it is never lost
 		int8_t fire = adc_values[2] == 0;
+		if (fire && !last_fire)
+			fire_pending = 1;
+		last_fire = fire;
 
-		game_update(
-			&g,
-			-rot,
-			thrust,
-			last_fire ? 0 : fire
-		);
-
-		if (0) if (usb_configured())
+		uint8_t ticks = 0;
+		while ((uint16_t)(clock_now() - last_tick) >= TICK_MS)
 		{
-			char buf[64];
-			for (uint8_t i = 0 ; i < MAX_ROCKS ; i++)
+			if (ticks++ == MAX_CATCHUP)
 			{
-				rock_t * const r = &g.r[i];
-				if (r->size == 0)
-					continue;
-				buf[0] = hexdigit(i);
-				buf[1] = hexdigit(r->p.vx >> 12);
-				buf[2] = hexdigit(r->p.vx >>  8);
-				buf[3] = hexdigit(r->p.vx >>  4);
-				buf[4] = hexdigit(r->p.vx >>  0);
-				buf[5] = '\r';
-				buf[6] = '\n';
-				usb_serial_write(buf, 7);
+				// Too far behind; slow down rather than stall
+				last_tick = clock_now();
+				break;
 			}
-			buf[0] = '-';
-			buf[1] = '\r';
-			buf[2] = '\n';
-			usb_serial_write(buf, 3);
-		}
 
-		last_fire = fire;
+			in.fire = fire_pending;
+			recorder_tick(&rec, &in);
+			game_update(&g, &in);
+
+			fire_pending = 0;
+			last_tick += TICK_MS;
+			pool_lost += g.stats.rocks_exhausted + g.stats.bullets_exhausted;
+
+			// If we hit something, start over
+			if (g.s.dead)
+				game_restart();
+		}
 	}
 }
 #endif
@@ -0,0 +1,205 @@
+/** \file
+ * Host benchmark for the spacewar orbit integrator.
+ *
+ *	make spacewar-bench
+ *	./spacewar-bench [years]
+ *
+ * Runs each planet for the given number of years with the fixed
+ * point leapfrog integrator and with the float update that spacewar
+ * used before, which projected the gravity with atan2(), cos() and
+ * sin() and took Euler steps in single precision.  For each one the
+ * worst and final error in the orbital energy are reported, along
+ * with the host time per update.
+ *
+ * The AVR has no FPU, so the float version is relatively far more
+ * expensive there than the host times suggest.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "orbit.h"
+
+#define GM		(6.67384e-11 * 1.989e30) // m^3 / s^2
+#define STEPS_PER_YEAR	((unsigned long) (365.25 * 24 * 3600 / ORBIT_DT))
+
+
+typedef struct
+{
+	const char * name;
+	double y; // m
+	double vx; // m/s
+} start_t;
+
+static const start_t starts[] = {
+	{ "Mercury", 46.001e9, 47870 },
+	{ "Venus", 107.477e9, 35020 },
+	{ "Earth", 147.098e9, 29780 },
+	{ "Mars", 206.669e9, 24007 },
+};
+
+
+/** The float planet_update() that spacewar used to have */
+typedef struct
+{
+	float x;
+	float y;
+	float vx;
+	float vy;
+} planet_float_t;
+
+static void
+planet_update_float(
+	planet_float_t * const s
+)
+{
+	float dx = 0 - s->x;
+	float dy = 0 - s->y;
+	float g = GM / (dx * dx + dy * dy);
+
+	const float dt = ORBIT_DT;
+	float theta = atan2f(dy, dx);
+	s->vx += g * cosf(theta) * dt;
+	s->vy += g * sinf(theta) * dt;
+
+	s->x += s->vx * dt;
+	s->y += s->vy * dt;
+}
+
+
+/** Orbital energy per unit mass, J/kg */
+static double
+energy(
+	const double x,
+	const double y,
+	const double vx,
+	const double vy
+)
+{
+	return (vx * vx + vy * vy) / 2 - GM / sqrt(x * x + y * y);
+}
+
+
+/** Energy of a fixed point orbit.  The velocity is half a step
+ * ahead, so take back half of the last kick to line it up with
+ * the position.
+ */
+static double
+energy_fixed(
+	const orbit_t * const o
+)
+{
+	const double pos = ORBIT_AU / (1L << ORBIT_AU_BITS);
+	const double vel = pos / (1 << ORBIT_VEL_FRAC) / ORBIT_DT;
+	int32_t ax;
+	int32_t ay;
+
+	orbit_accel(o->x, o->y, &ax, &ay);
+
+	return energy(
+		o->x * pos,
+		o->y * pos,
+		(o->vx - ax / 2.0) * vel,
+		(o->vy - ay / 2.0) * vel
+	);
+}
+
+
+static double
+elapsed_ns(
+	const struct timespec * const start,
+	const struct timespec * const end
+)
+{
+	return (end->tv_sec - start->tv_sec) * 1e9
+		+ (end->tv_nsec - start->tv_nsec);
+}
+
+
+int
+main(
+	int argc,
+	char ** argv
+)
+{
+	const unsigned years = argc > 1 ? strtoul(argv[1], NULL, 0) : 100;
+	const unsigned long steps = years * STEPS_PER_YEAR;
+
+	printf("%u years, %lu steps of %.0f s\n", years, steps, ORBIT_DT);
+	printf("%-8s %-6s %12s %12s %10s\n",
+		"planet",
+		"method",
+		"worst dE/E",
+		"final dE/E",
+		"ns/update"
+	);
+
+	for (unsigned i = 0 ; i < sizeof(starts) / sizeof(*starts) ; i++)
+	{
+		const start_t * const p = &starts[i];
+		const double e0 = energy(0, p->y, p->vx, 0);
+		struct timespec start;
+		struct timespec end;
+		double worst = 0;
+		double de = 0;
+
+		orbit_t o = {
+			.x = 0,
+			.y = ORBIT_POS(p->y),
+			.vx = ORBIT_VEL(p->vx),
+			.vy = 0,
+		};
+
+		// timed separately so the energy checks are not counted
+		orbit_t timed = o;
+		orbit_start(&timed);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (unsigned long t = 0 ; t < steps ; t++)
+			orbit_step(&timed);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		orbit_start(&o);
+		for (unsigned long t = 0 ; t < steps ; t++)
+		{
+			orbit_step(&o);
+			de = energy_fixed(&o) / e0 - 1;
+			if (fabs(de) > worst)
+				worst = fabs(de);
+		}
+
+		printf("%-8s %-6s %12.2e %12.2e %10.1f\n",
+			p->name,
+			"fixed",
+			worst,
+			de,
+			elapsed_ns(&start, &end) / steps
+		);
+
+		planet_float_t f = { 0, p->y, p->vx, 0 };
+		planet_float_t ftimed = f;
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (unsigned long t = 0 ; t < steps ; t++)
+			planet_update_float(&ftimed);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		worst = 0;
+		for (unsigned long t = 0 ; t < steps ; t++)
+		{
+			planet_update_float(&f);
+			de = energy(f.x, f.y, f.vx, f.vy) / e0 - 1;
+			if (fabs(de) > worst)
+				worst = fabs(de);
+		}
+
+		printf("%-8s %-6s %12.2e %12.2e %10.1f\n",
+			p->name,
+			"float",
+			worst,
+			de,
+			elapsed_ns(&start, &end) / steps
+		);
+	}
+
+	return 0;
+}
@@ -5,197 +5,511 @@
 
 #include <avr/io.h>
 #include <stdint.h>
-#include <math.h>
 #include "vector.h"
 #include "clock.h"
+#include "orbit.h"
+#include "viewport.h"
+#include "memspaces.h"
 
+/** Define CONFIG_PLANET_EPHEMERIS, for instance in CDEFS in the
+ * Makefile, to show the planets on their Kepler orbits, sped up by
+ * ORRERY_DAYS_PER_SEC, rather than integrating their motion.
+ * Each position is a table lookup, so there is nothing to drift.
+ * The clock only knows the time of day, so the planets start from
+ * their J2000 positions every midnight.
+ */
+#ifndef ORRERY_DAYS_PER_SEC
+#define ORRERY_DAYS_PER_SEC	1
+#endif
+
+#define PLANET_COUNT 4
+
+
+/** Planets are drawn from positions in 2^-10 AU, which covers the
+ * orbits out to Mars in 16 bits with a tenth of a pixel to spare.
+ * At zoom 0 the view is 80 pixels per AU, so 1.6 AU fills the screen.
+ */
+#define WORLD_SHIFT		(ORBIT_AU_BITS - 10)
+#define WORLD_SCALE		5120 // 80 / 1024 pixels per unit, Q16
+#define WORLD_PAN		16 // pixels per pan command
+
+
+/** Orbit trails.
+ * Each planet keeps its recent positions in a ring, in world units.  A
+ * new position replaces the newest one until the path has turned far
+ * enough to move it more than TRAIL_TOLERANCE off the straight line
+ * from the point before, so each point stands for as much of the
+ * orbit as can be drawn with a single line.  The trail is drawn as
+ * one polyline from the oldest point to the planet.
+ *
+ * PLANET_TRAIL_LEN points are kept for each planet, and all of the
+ * trails together must fit in PLANET_TRAIL_BUDGET line segments.
+ */
+#ifndef PLANET_TRAIL_LEN
+#define PLANET_TRAIL_LEN	16
+#endif
 
-// To save cpu time, the sun is at (0,0)
-#define SUN_X 0
-#define SUN_Y 0
-#define SUN_MASS 1.989e30 // kg
+#define PLANET_TRAIL_BUDGET	64
+#define TRAIL_TOLERANCE		6 // 2^-10 AU, about half a pixel
+#define TRAIL_JUMP		128 // 1/8 AU, further than this restarts the trail
 
-#define GRAVITY 6.67384e-11 // N m / kg^2
-#define ONE_AU 149e9 // m
+#if PLANET_TRAIL_LEN * PLANET_COUNT > PLANET_TRAIL_BUDGET
+#error "PLANET_TRAIL_LEN is over the segment budget"
+#endif
+
+
+typedef struct
+{
+	int16_t x[PLANET_TRAIL_LEN];
+	int16_t y[PLANET_TRAIL_LEN];
+	uint8_t head; // next to be written
+	uint8_t count;
+
+	// the newest position, which is not in the ring yet
+	uint8_t primed;
+	int16_t px;
+	int16_t py;
+} trail_t;
 
+
+// To save cpu time, the sun is at (0,0) and the planets do not
+// attract each other, so their masses do not matter.
 typedef struct
 {
-	float x;
-	float y;
-	float vx;
-	float vy;
-	float mass;
+	orbit_t orbit;
+	kepler_t kepler;
+	trail_t trail;
 } planet_t;
 
 
-#define PLANET_COUNT 4
-static planet_t planets[] =
+/** Half of each orbit, perihelion on +x, in 2^-14 AU, from:
+$pi = 4 * atan2(1, 1);
+for ([0.38710, 0.20563, 77.456], [0.72333, 0.00677, 131.602], [1.00000, 0.01671, 102.937], [1.52368, 0.09340, 336.060]) {
+	($a, $e, $w) = @$_; printf "// a=%.5f e=%.5f w=%.3f: cos %.0f sin %.0f\n", $a, $e, $w, 16384 * cos($w * $pi / 180), 16384 * sin($w * $pi / 180);
+	for $i (0..32) { $M = $pi * $i / 32; $E = $M; $E = $M + $e * sin($E) for 1..50;
+	printf "\t{ %.0f, %.0f },\n", 16384 * $a * (cos($E) - $e), 16384 * $a * sqrt(1 - $e * $e) * sin($E) } }
+ */
+static const kepler_point_t PROGMEM mercury_kepler[] = {
+	{ 5038, 0 },
+	{ 4990, 765 },
+	{ 4846, 1515 },
+	{ 4612, 2236 },
+	{ 4294, 2918 },
+	{ 3900, 3547 },
+	{ 3441, 4118 },
+	{ 2927, 4623 },
+	{ 2369, 5060 },
+	{ 1778, 5424 },
+	{ 1163, 5718 },
+	{ 534, 5940 },
+	{ -101, 6094 },
+	{ -736, 6182 },
+	{ -1363, 6206 },
+	{ -1977, 6172 },
+	{ -2573, 6081 },
+	{ -3148, 5939 },
+	{ -3697, 5748 },
+	{ -4217, 5513 },
+	{ -4707, 5238 },
+	{ -5163, 4926 },
+	{ -5584, 4580 },
+	{ -5969, 4205 },
+	{ -6317, 3803 },
+	{ -6625, 3377 },
+	{ -6894, 2932 },
+	{ -7123, 2469 },
+	{ -7311, 1992 },
+	{ -7457, 1504 },
+	{ -7562, 1007 },
+	{ -7625, 505 },
+	{ -7646, 0 },
+};
+
+static const kepler_point_t PROGMEM venus_kepler[] = {
+	{ 11771, 0 },
+	{ 11713, 1169 },
+	{ 11540, 2327 },
+	{ 11254, 3463 },
+	{ 10857, 4564 },
+	{ 10353, 5620 },
+	{ 9749, 6621 },
+	{ 9048, 7558 },
+	{ 8259, 8420 },
+	{ 7390, 9200 },
+	{ 6448, 9891 },
+	{ 5444, 10485 },
+	{ 4386, 10977 },
+	{ 3286, 11363 },
+	{ 2154, 11638 },
+	{ 1002, 11801 },
+	{ -160, 11850 },
+	{ -1321, 11786 },
+	{ -2469, 11607 },
+	{ -3594, 11318 },
+	{ -4684, 10920 },
+	{ -5729, 10418 },
+	{ -6719, 9816 },
+	{ -7646, 9121 },
+	{ -8500, 8340 },
+	{ -9273, 7479 },
+	{ -9959, 6547 },
+	{ -10550, 5553 },
+	{ -11041, 4507 },
+	{ -11428, 3418 },
+	{ -11707, 2297 },
+	{ -11875, 1154 },
+	{ -11931, 0 },
+};
+
+static const kepler_point_t PROGMEM earth_kepler[] = {
+	{ 16110, 0 },
+	{ 16029, 1633 },
+	{ 15785, 3249 },
+	{ 15381, 4833 },
+	{ 14822, 6367 },
+	{ 14113, 7838 },
+	{ 13263, 9229 },
+	{ 12279, 10528 },
+	{ 11172, 11721 },
+	{ 9954, 12798 },
+	{ 8637, 13747 },
+	{ 7234, 14560 },
+	{ 5760, 15230 },
+	{ 4230, 15751 },
+	{ 2658, 16117 },
+	{ 1060, 16327 },
+	{ -548, 16379 },
+	{ -2150, 16274 },
+	{ -3732, 16013 },
+	{ -5279, 15599 },
+	{ -6775, 15037 },
+	{ -8208, 14333 },
+	{ -9563, 13494 },
+	{ -10829, 12529 },
+	{ -11994, 11448 },
+	{ -13047, 10259 },
+	{ -13979, 8976 },
+	{ -14783, 7610 },
+	{ -15450, 6174 },
+	{ -15975, 4680 },
+	{ -16353, 3144 },
+	{ -16581, 1579 },
+	{ -16658, 0 },
+};
+
+static const kepler_point_t PROGMEM mars_kepler[] = {
+	{ 22632, 0 },
+	{ 22486, 2686 },
+	{ 22050, 5337 },
+	{ 21331, 7920 },
+	{ 20341, 10402 },
+	{ 19096, 12753 },
+	{ 17614, 14947 },
+	{ 15918, 16959 },
+	{ 14033, 18770 },
+	{ 11984, 20362 },
+	{ 9799, 21723 },
+	{ 7505, 22844 },
+	{ 5131, 23718 },
+	{ 2702, 24344 },
+	{ 246, 24722 },
+	{ -2212, 24855 },
+	{ -4650, 24747 },
+	{ -7044, 24408 },
+	{ -9373, 23846 },
+	{ -11620, 23071 },
+	{ -13765, 22095 },
+	{ -15793, 20932 },
+	{ -17690, 19594 },
+	{ -19443, 18097 },
+	{ -21041, 16455 },
+	{ -22473, 14684 },
+	{ -23731, 12799 },
+	{ -24808, 10816 },
+	{ -25697, 8751 },
+	{ -26394, 6621 },
+	{ -26894, 4441 },
+	{ -27195, 2229 },
+	{ -27296, 0 },
+};
+
+
+static planet_t planets[PLANET_COUNT] =
 {
 	{
-		// Mercury
-		.mass = 328.5e21, // kg
-		.x = 0,
-		.y = 46.001e9, // m
-		.vx = 47870, // m/s
-		.vy = 0,
+		// Mercury, 328.5e21 kg
+		.orbit = {
+			.x = 0,
+			.y = ORBIT_POS(46.001e9), // m
+			.vx = ORBIT_VEL(47870), // m/s
+			.vy = 0,
+		},
+		.kepler = {
+			.table = mercury_kepler,
+			.phase = KEPLER_ANGLE(174.795), // J2000 mean anomaly
+			.rate = KEPLER_RATE(87.969, ORRERY_DAYS_PER_SEC),
+			.rate_ms = KEPLER_RATE(87.969, ORRERY_DAYS_PER_SEC) / 1000,
+			.cos_w = 3558,
+			.sin_w = 15993,
+		},
 	},
 	{
-		// Venus
-		.mass = 4.868e24, // kg
-		.x = 0,
-		.y = 107.477e9, // m
-		.vx = 35020, // m/s
-		.vy = 0,
+		// Venus, 4.868e24 kg
+		.orbit = {
+			.x = 0,
+			.y = ORBIT_POS(107.477e9), // m
+			.vx = ORBIT_VEL(35020), // m/s
+			.vy = 0,
+		},
+		.kepler = {
+			.table = venus_kepler,
+			.phase = KEPLER_ANGLE(50.378), // J2000 mean anomaly
+			.rate = KEPLER_RATE(224.701, ORRERY_DAYS_PER_SEC),
+			.rate_ms = KEPLER_RATE(224.701, ORRERY_DAYS_PER_SEC) / 1000,
+			.cos_w = -10878,
+			.sin_w = 12252,
+		},
 	},
 	{
-		// Earth
-		.mass = 5.974e24,
-		.x = 0,
-		.y = 147.098e9, // m
-		.vx = 29780, // m/s
-		.vy = 0,
+		// Earth, 5.974e24 kg
+		.orbit = {
+			.x = 0,
+			.y = ORBIT_POS(147.098e9), // m
+			.vx = ORBIT_VEL(29780), // m/s
+			.vy = 0,
+		},
+		.kepler = {
+			.table = earth_kepler,
+			.phase = KEPLER_ANGLE(357.527), // J2000 mean anomaly
+			.rate = KEPLER_RATE(365.256, ORRERY_DAYS_PER_SEC),
+			.rate_ms = KEPLER_RATE(365.256, ORRERY_DAYS_PER_SEC) / 1000,
+			.cos_w = -3668,
+			.sin_w = 15968,
+		},
 	},
 	{
-		// Mars
-		.mass = 6.419e23,
-		.x = 0,
-		.y = 206.669e9, // m
-		.vx = 24007, // m/s
-		.vy = 0,
+		// Mars, 6.419e23 kg
+		.orbit = {
+			.x = 0,
+			.y = ORBIT_POS(206.669e9), // m
+			.vx = ORBIT_VEL(24007), // m/s
+			.vy = 0,
+		},
+		.kepler = {
+			.table = mars_kepler,
+			.phase = KEPLER_ANGLE(19.393), // J2000 mean anomaly
+			.rate = KEPLER_RATE(686.980, ORRERY_DAYS_PER_SEC),
+			.rate_ms = KEPLER_RATE(686.980, ORRERY_DAYS_PER_SEC) / 1000,
+			.cos_w = 14974,
+			.sin_w = -6648,
+		},
 	},
 };
 
 
-/** Precomputed inverse square law gravity forces:
- * perl -e 'printf "%d,\n", 8192 / sqrt($_ * 1024) for 1..16'
- */
-static const uint8_t gravity_table[] = {
-0, // means dead
-255, // way fast!
-181,
-147,
-128,
-114,
-104,
-96,
-90,
-85,
-80,
-77,
-73,
-71,
-68,
-66,
-64,
-62,
-60,
-58,
-57,
-55,
-54,
-53,
-52,
-51,
-50,
-49,
-48,
-47,
-46,
-45,
-};
+void
+planet_update(
+	planet_t * s
+)
+{
+	orbit_step(&s->orbit);
+}
 
 
-/** Compute G m1*m2 / r^2 for a planet.
- *
- * Distances are in m, mass in kg.
- * Return is in m/s^2
- */
-static float
-gravity(
-	float dx,
-	float dy
+static viewport_t view;
+
+
+static void
+trail_add(
+	trail_t * t,
+	int16_t x,
+	int16_t y
 )
 {
-#if 0
-	dx /= 256;
-	dy /= 256;
-
-	// maximum dx == 32768 => 128
-	// maximum delta = 128*128*2 == 32768
-	// gravity table has up to 32 entries
-	uint16_t delta = dx*dx + dx*dx;
-	return gravity_table[delta / 1024];
-#else
+	const int16_t dx = x - t->px;
+	const int16_t dy = y - t->py;
+
+	if (!t->primed
+	||  dx > TRAIL_JUMP || dx < -TRAIL_JUMP
+	||  dy > TRAIL_JUMP || dy < -TRAIL_JUMP)
+	{
+		// first position, or the clock has jumped
+		t->count = 0;
+		t->primed = 1;
+		t->px = x;
+		t->py = y;
+		return;
+	}
+
 	if (dx == 0 && dy == 0)
-		return 0;
+		return;
 
-	// dx,dy are in m
-	// mass is in kg
-	float r_squared = (dx * dx + dy * dy);
-	return GRAVITY * SUN_MASS / r_squared;
-#endif
+	if (t->count != 0)
+	{
+		// how far the newest position is off the line from the
+		// last point in the ring to the new one, times its length
+		const uint8_t last = (t->head ? t->head : PLANET_TRAIL_LEN) - 1;
+		const int16_t ax = x - t->x[last];
+		const int16_t ay = y - t->y[last];
+		const int16_t bx = t->px - t->x[last];
+		const int16_t by = t->py - t->y[last];
+
+		int32_t cross = (int32_t) ax * by - (int32_t) ay * bx;
+		if (cross < 0)
+			cross = -cross;
+
+		// the manhattan length is at most 1.4 times too long
+		const int16_t len = (ax < 0 ? -ax : ax) + (ay < 0 ? -ay : ay);
+
+		if (cross <= (int32_t) TRAIL_TOLERANCE * len)
+		{
+			t->px = x;
+			t->py = y;
+			return;
+		}
+	}
+
+	// the path has turned; keep the newest position
+	t->x[t->head] = t->px;
+	t->y[t->head] = t->py;
+	if (++t->head == PLANET_TRAIL_LEN)
+		t->head = 0;
+	if (t->count < PLANET_TRAIL_LEN)
+		t->count++;
+
+	t->px = x;
+	t->py = y;
 }
 
 
-void
-planet_update(
-	planet_t * s
+/** Draw the trail as one polyline ending at the newest position.
+ * Each line starts where the last one ended, so the beam never has
+ * to move with the pen up unless part of the trail is off screen.
+ */
+static void
+trail_draw(
+	const trail_t * t
 )
 {
-	float dx = SUN_X - s->x;
-	float dy = SUN_X - s->y;
-	float g = gravity(dx, dy);
-
-	// Project the gravity in the direction of the sun.
-	const float dt = 3600.0; // one day
-	float theta = atan2(dy, dx);
-	s->vx += g * cos(theta) * dt;
-	s->vy += g * sin(theta) * dt;
-
-	s->x += s->vx * dt;
-	s->y += s->vy * dt;
-
-/*
-	if (s->x > 32768)
-		s->x = s->x - 65536.0;
-	if (s->x < -32768)
-		s->x = 65536.0 - s->x;
-	if (s->y > 32768)
-		s->y = s->y - 65536.0;
-	if (s->y < -32768)
-		s->y = 65536.0 - s->y;
-*/
+	const viewport_t * const v = &view;
+
+	if (!t->primed || t->count == 0)
+		return;
+
+	uint8_t i = t->count < PLANET_TRAIL_LEN ? 0 : t->head;
+	uint8_t x0;
+	uint8_t y0;
+	uint8_t on = viewport_point(v, t->x[i], t->y[i], &x0, &y0);
+
+	for (uint8_t n = 1 ; n <= t->count ; n++)
+	{
+		uint8_t x1;
+		uint8_t y1;
+		uint8_t on1;
+
+		if (n == t->count)
+		{
+			on1 = viewport_point(v, t->px, t->py, &x1, &y1);
+		} else {
+			if (++i == PLANET_TRAIL_LEN)
+				i = 0;
+			on1 = viewport_point(v, t->x[i], t->y[i], &x1, &y1);
+		}
+
+		if (on && on1)
+			line(x0, y0, x1, y1);
+
+		x0 = x1;
+		y0 = y1;
+		on = on1;
+	}
 }
 
 
+/** Zoom and pan the view.
+ * + and - zoom in and out, h j k l pan and 0 goes back to the
+ * whole solar system.
+ */
 void
-planet_draw(
-	planet_t * s,
-	int i
+planet_command(
+	uint8_t c
 )
 {
-	// Scale x and y so that 1.6 au == 128
-	float x = (s->x / (ONE_AU * 1.6)) * 128 + 128;
-	float y = (s->y / (ONE_AU * 1.6)) * 128 + 128;
-	if (x < 0 || x > 250 || y < 0 || y > 250)
-		return;
+	switch (c)
+	{
+	case '+':
+	case '=': viewport_zoom(&view, 1); break;
+	case '-': viewport_zoom(&view, -1); break;
+	case 'h': viewport_pan(&view, -WORLD_PAN, 0); break;
+	case 'l': viewport_pan(&view, WORLD_PAN, 0); break;
+	case 'j': viewport_pan(&view, 0, -WORLD_PAN); break;
+	case 'k': viewport_pan(&view, 0, WORLD_PAN); break;
+	case '0': viewport_init(&view, 0, 0, WORLD_SCALE); break;
+	default: break;
+	}
+}
+
+
+/** Map all of the planets to the screen at once and draw them
+ * with their trails.
+ */
+static void
+planet_draw(void)
+{
+	int16_t wx[PLANET_COUNT];
+	int16_t wy[PLANET_COUNT];
+	uint8_t sx[PLANET_COUNT];
+	uint8_t sy[PLANET_COUNT];
+	uint8_t on[PLANET_COUNT];
+
+	for (uint8_t i = 0 ; i < PLANET_COUNT ; i++)
+	{
+		planet_t * const s = &planets[i];
+		wx[i] = s->orbit.x >> WORLD_SHIFT;
+		wy[i] = s->orbit.y >> WORLD_SHIFT;
+		trail_add(&s->trail, wx[i], wy[i]);
+	}
 
-	//line(x, y, x+s->vx*100, y+s->vy*100);
-	draw_char_small(x, y, i + '0');
+	viewport_map(&view, wx, wy, PLANET_COUNT, sx, sy, on);
 
-	//line_horiz(x-5, y, 10);
-	//line_vert(x, y-5, 10);
+	for (uint8_t i = 0 ; i < PLANET_COUNT ; i++)
+	{
+		trail_draw(&planets[i].trail);
+		if (on[i])
+			draw_char_small(sx[i], sy[i], i + '1');
+	}
 }
 
 
 void
 planet_loop(void)
 {
+	// the scale is never 0 once the view has been set up
+	if (view.scale == 0)
+		viewport_init(&view, 0, 0, WORLD_SCALE);
+
+#ifdef CONFIG_PLANET_EPHEMERIS
+	uint16_t ms;
+	const uint32_t sec = clock_time_of_day(&ms);
+
 	for (int i = 0 ; i < PLANET_COUNT ; i++)
+		orbit_kepler(&planets[i].orbit, &planets[i].kepler, sec, ms);
+
+	planet_draw();
+#else
+	static uint8_t started;
+	if (!started)
 	{
-		planet_draw(&planets[i], i+1);
-		planet_update(&planets[i]);
+		for (int i = 0 ; i < PLANET_COUNT ; i++)
+			orbit_start(&planets[i].orbit);
+		started = 1;
 	}
 
+	planet_draw();
+
+	for (int i = 0 ; i < PLANET_COUNT ; i++)
+		planet_update(&planets[i]);
+#endif
+
 	PORTB = PORTD = 128;
 }
@@ -0,0 +1,307 @@
+/** \file
+ * Host check and cost of drawing text that runs off the screen.
+ *
+ *	make text-bench
+ *	./text-bench
+ *
+ * vector.c is linked in with the DAC ports and _delay_us() provided
+ * here, so every step of the beam is recorded into a bitmap of the
+ * screen.  Strings and rotated characters are drawn partly off each
+ * edge of the screen and compared with the same text drawn entirely
+ * on it and shifted by the same amount.  Every step must be within a
+ * pixel of the shifted text, and the shifted text within a pixel of
+ * a step wherever it is on the screen.  Anything that wraps round to
+ * the far side of the screen fails the first test.
+ *
+ * Exits non-zero if any of them fail.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "vector.h"
+
+volatile uint8_t PORTB;
+volatile uint8_t PORTD;
+
+static uint8_t screen[256][256];
+static unsigned long steps;
+
+
+/** Called by vector.c; only the per step delays light the beam */
+void
+_delay_us(
+	double us
+)
+{
+	if (us != 5 && us != 7)
+		return;
+
+	screen[PORTB][PORTD] = 1;
+	steps++;
+}
+
+
+static double
+now_ns(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+
+/** Something that draws text with its origin at (x,y) */
+typedef void (*draw_fn)(int16_t x, int16_t y, const void * arg);
+
+
+typedef struct
+{
+	font_t font;
+	uint8_t scale;
+	const char * s;
+} string_arg_t;
+
+
+static void
+draw_string_at(
+	const int16_t x,
+	const int16_t y,
+	const void * const arg
+)
+{
+	const string_arg_t * const a = arg;
+	draw_string(a->font, x, y, a->s, a->scale);
+}
+
+
+typedef struct
+{
+	font_t font;
+	uint8_t theta;
+	uint8_t scale;
+	int8_t ox; // font units from the centre of the glyph to its origin
+	int8_t oy;
+	char c;
+} rot_arg_t;
+
+
+/** The rotation centre is at (x,y), which must be on the screen */
+static void
+draw_rot_at(
+	const int16_t x,
+	const int16_t y,
+	const void * const arg
+)
+{
+	const rot_arg_t * const a = arg;
+	vector_rot_t r;
+
+	vector_rot_init(&r, a->theta);
+	r.scale = a->scale;
+	r.cx = x;
+	r.cy = y;
+	draw_char_rot_font(&r, a->font, a->ox, a->oy, a->c);
+}
+
+
+static uint8_t
+lit_near(
+	const uint8_t (* const bitmap)[256],
+	const int x,
+	const int y
+)
+{
+	for (int dx = -1 ; dx <= 1 ; dx++)
+	{
+		for (int dy = -1 ; dy <= 1 ; dy++)
+		{
+			const int px = x + dx;
+			const int py = y + dy;
+			if (px < 0 || px > 255 || py < 0 || py > 255)
+				continue;
+			if (bitmap[px][py])
+				return 1;
+		}
+	}
+
+	return 0;
+}
+
+
+/** Draw at (x,y) and at (x+dx,y+dy), which must be on the screen,
+ * and compare the two.  Returns the number of pixels that are wrong.
+ */
+static unsigned
+compare(
+	const draw_fn draw,
+	const void * const arg,
+	const int16_t x,
+	const int16_t y,
+	const int16_t dx,
+	const int16_t dy
+)
+{
+	static uint8_t ref[256][256];
+	unsigned wrong = 0;
+
+	memset(screen, 0, sizeof(screen));
+	draw(x + dx, y + dy, arg);
+	memcpy(ref, screen, sizeof(ref));
+
+	memset(screen, 0, sizeof(screen));
+	draw(x, y, arg);
+
+	for (int i = 0 ; i < 256 ; i++)
+	{
+		for (int j = 0 ; j < 256 ; j++)
+		{
+			// a step with nothing drawn near it in the reference
+			if (screen[i][j] && !lit_near(ref, i + dx, j + dy))
+				wrong++;
+
+			// a reference pixel, away from the edge, that was
+			// not drawn
+			const int si = i - dx;
+			const int sj = j - dy;
+			if (ref[i][j]
+			&&  0 < si && si < 255
+			&&  0 < sj && sj < 255
+			&&  !lit_near(screen, si, sj))
+				wrong++;
+		}
+	}
+
+	return wrong;
+}
+
+
+/** Move the text across each edge of the screen, with its origin
+ * from lo to hi, and compare it with the text in the middle of the
+ * screen.  bb is the extent of the text from its origin.
+ */
+static int
+check(
+	const char * const name,
+	const draw_fn draw,
+	const void * const arg,
+	const text_bbox_t * const bb,
+	const int16_t lo,
+	const int16_t hi
+)
+{
+	const int16_t mx = 128 - (bb->x0 + bb->x1) / 2;
+	const int16_t my = 128 - (bb->y0 + bb->y1) / 2;
+	unsigned long wrong = 0;
+	unsigned long cases = 0;
+
+	for (int16_t x = -bb->x1 - 2 ; x <= 257 - bb->x0 ; x += 3)
+	{
+		if (x < lo || x > hi)
+			continue;
+		wrong += compare(draw, arg, x, my, mx - x, 0);
+		cases++;
+	}
+
+	for (int16_t y = -bb->y1 - 2 ; y <= 257 - bb->y0 ; y += 3)
+	{
+		if (y < lo || y > hi)
+			continue;
+		wrong += compare(draw, arg, mx, y, 0, my - y);
+		cases++;
+	}
+
+	printf("%s: %-24s %4lu cases, %lu pixels wrong\n",
+		wrong ? "FAIL" : "ok  ",
+		name,
+		cases,
+		wrong
+	);
+
+	return wrong != 0;
+}
+
+
+/** Time drawing a string on the screen and half off it */
+static void
+costs(
+	const string_arg_t * const a
+)
+{
+	const unsigned n = 4096;
+	const int16_t w = string_width(a->font, a->s, a->scale);
+	const int16_t xs[] = { 10, -w / 2 };
+	const char * const where[] = { "on screen", "half off" };
+
+	for (unsigned i = 0 ; i < 2 ; i++)
+	{
+		steps = 0;
+		const double t0 = now_ns();
+		for (unsigned j = 0 ; j < n ; j++)
+			draw_string(a->font, xs[i], 100, a->s, a->scale);
+		const double t1 = now_ns();
+
+		printf("font %u %-10s \"%s\" x%u: %5lu steps, %6.0f ns on the host\n",
+			a->font,
+			where[i],
+			a->s,
+			a->scale,
+			steps / n,
+			(t1 - t0) / n
+		);
+	}
+}
+
+
+int
+main(void)
+{
+	int failed = 0;
+
+	for (font_t font = FONT_ASTEROIDS ; font <= FONT_HERSHEY_SCRIPT ; font++)
+	{
+		for (uint8_t scale = 0 ; scale <= 4 ; scale++)
+		{
+			const string_arg_t a = { font, scale, "Wg8@" };
+			text_bbox_t bb;
+			string_bbox(font, a.s, scale, &bb);
+
+			char name[32];
+			snprintf(name, sizeof(name), "string font %u scale %u",
+				font,
+				scale
+			);
+			failed |= check(name, draw_string_at, &a, &bb, INT16_MIN, INT16_MAX);
+		}
+
+		// rotate about the middle of the glyph, so that it stays
+		// inside the same circle at any angle
+		glyph_bbox_t gb;
+		font_bbox(font, '@', &gb);
+		const int8_t ox = -(gb.x0 + gb.x1) / 2;
+		const int8_t oy = -(gb.y0 + gb.y1) / 2;
+		const uint8_t scale = 48;
+		const int16_t radius = (abs(gb.x1 - gb.x0) + abs(gb.y1 - gb.y0)) * scale / 128 + 2;
+		const text_bbox_t rb = { -radius, -radius, radius, radius };
+
+		for (uint8_t theta = 0 ; theta < 240 ; theta += 40)
+		{
+			const rot_arg_t a = { font, theta, scale, ox, oy, '@' };
+
+			char name[32];
+			snprintf(name, sizeof(name), "rotated font %u theta %u",
+				font,
+				theta
+			);
+			failed |= check(name, draw_rot_at, &a, &rb, 0, 255);
+		}
+	}
+
+	printf("\n");
+	costs(&(string_arg_t) { FONT_HERSHEY_SIMPLEX, 2, "Hello, World" });
+	costs(&(string_arg_t) { FONT_HERSHEY_SCRIPT, 2, "Hello, World" });
+	costs(&(string_arg_t) { FONT_ASTEROIDS, 2, "Hello, World" });
+
+	return failed;
+}
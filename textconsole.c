@@ -14,6 +14,9 @@
 #include "sin_table.h"
 #include "vector.h"
 #include "clock.h"
+#ifdef CONFIG_WIRE_ALERT
+#include "wire3d.h"
+#endif
 
 
 
@@ -76,6 +79,19 @@ static vector_rot_t rot = {
 	.cy = 128,
 };
 
+#ifdef CONFIG_WIRE_ALERT
+/** Draw the attract screen's ALERT! as a spinning 3D wireframe
+ * instead of rotating it in the plane of the screen.
+ */
+static const wire_camera_t alert_cam = {
+	.cx = 128,
+	.cy = 128,
+	.focal = 256,
+};
+
+static wire_point_t alert_cache[WIRE_ALERT_VERTICES];
+#endif
+
 
 static void
 draw_text(void)
@@ -130,6 +146,22 @@ int main(void)
 		&& usb_serial_get_control() & USB_SERIAL_DTR)
 			break;
 
+#ifdef CONFIG_WIRE_ALERT
+		// spin the text and move it in and out, which takes it
+		// from about 100 to 180 pixels wide
+		const uint8_t depth = size >= 128 ? 255 - size : size;
+		size = (size + 3);
+
+		wire_matrix_t m;
+		wire_identity(&m);
+		wire_rotate_y(&m, theta * 64);
+		wire_rotate_x(&m, fix_sin(theta * 48) / 8);
+		wire_translate(&m, 0, 0, WIRE_UNITS(190) + WIRE_UNITS(depth));
+		theta++;
+
+		if (!wire_transform(&wire_alert, &m, &alert_cam, alert_cache))
+			wire_draw(&wire_alert, alert_cache);
+#else
 		vector_rot_init(&rot, (theta++) / 4);
 
 		if (size >= 128)
@@ -145,6 +177,7 @@ int main(void)
 		draw_char_rot(&rot, +20, -10, 'R');
 		draw_char_rot(&rot, +40, -10, 'T');
 		draw_char_rot(&rot, +60, -10, '!');
+#endif
 
 		draw_char_med(30, 60, '#');
 		draw_char_med(50, 60, 'F');
@@ -4,18 +4,31 @@
  *
  */
 
+#include <stdint.h>
+#include <string.h>
+#ifdef __AVR__
 #include <avr/io.h>
 #include <avr/pgmspace.h>
 #include <avr/interrupt.h>
-#include <stdint.h>
-#include <string.h>
 #include <util/delay.h>
 #include "usb_serial.h"
 #include "bits.h"
-#include "hershey.h"
-#include "asteroids-font.h"
+#else
+/** Host programs, such as text-bench, that link in the drawing code
+ * provide the DAC ports and the delay, so that they can watch the beam.
+ */
+extern volatile uint8_t PORTB;
+extern volatile uint8_t PORTD;
+
+extern void
+_delay_us(
+	double us
+);
+#endif
+#include "memspaces.h"
 #include "vector.h"
 #include "sin_table.h"
+#include "xform.h"
 
 
 /** Slow scopes require time at each move; give them the chance */
@@ -211,6 +224,570 @@ line(
 }
 
 
+/** A diagonal step is sqrt(2) longer than a straight one, so it waits
+ * that much longer to keep the beam speed, and so the brightness, the
+ * same all the way round a curve.
+ */
+static inline void
+pixel_delay_diag(void)
+{
+#ifdef CONFIG_SLOW_SCOPE
+	_delay_us(7);
+#endif
+}
+
+
+void
+vector_arc_init(
+	vector_arc_t * const a,
+	const uint8_t cx,
+	const uint8_t cy,
+	const uint8_t rx,
+	const uint8_t ry,
+	const uint16_t start,
+	const uint16_t end
+)
+{
+	a->cx = cx;
+	a->cy = cy;
+	a->rx = rx > VECTOR_ARC_MAX ? VECTOR_ARC_MAX : rx;
+	a->ry = ry > VECTOR_ARC_MAX ? VECTOR_ARC_MAX : ry;
+
+	if (start == end)
+	{
+		// the whole way round, starting and ending on +x
+		a->q0 = 0;
+		a->quadrants = 4;
+		a->full = 1;
+		return;
+	}
+
+	const uint8_t q0 = start >> 14;
+	const uint8_t q1 = end >> 14;
+
+	a->q0 = q0;
+	a->full = 0;
+	if (q0 == q1 && end < start)
+		a->quadrants = 5;
+	else
+		a->quadrants = ((q1 - q0) & 3) + 1;
+
+	a->c0 = fix_cos(start);
+	a->s0 = fix_sin(start);
+	a->c1 = fix_cos(end);
+	a->s1 = fix_sin(end);
+}
+
+
+/** Where the beam is going round an arc */
+typedef struct
+{
+	const vector_arc_t * a;
+	int16_t x; // relative to the centre
+	int16_t y;
+	int32_t cross0; // which side of the start and end rays
+	int32_t cross1;
+	uint8_t check_start;
+	uint8_t check_end;
+	uint8_t drawing;
+} arc_beam_t;
+
+
+static inline int16_t
+signed_by(
+	const int16_t v,
+	const int8_t d
+)
+{
+	return d > 0 ? v : d < 0 ? -v : 0;
+}
+
+
+/** Move the beam one step round the arc.  Nothing is drawn until it
+ * reaches the start ray, and it returns 0 once it passes the end.
+ */
+static uint8_t
+arc_step(
+	arc_beam_t * const b,
+	const int8_t dx,
+	const int8_t dy
+)
+{
+	const vector_arc_t * const a = b->a;
+
+	b->x += dx;
+	b->y += dy;
+
+	// the cross products with the rays only need adds
+	if (!a->full)
+	{
+		b->cross0 += signed_by(a->c0, dy) - signed_by(a->s0, dx);
+		b->cross1 += signed_by(a->c1, dy) - signed_by(a->s1, dx);
+	}
+
+	if (!b->drawing)
+	{
+		if (b->check_start && b->cross0 < 0)
+			return 1;
+		if (b->check_end && b->cross1 > 0)
+			return 0;
+
+		moveto(a->cx + b->x, a->cy + b->y);
+		b->drawing = 1;
+		return 1;
+	}
+
+	if (b->check_end && b->cross1 > 0)
+		return 0;
+
+	if (dx)
+		PORTB = a->cx + b->x;
+	if (dy)
+		PORTD = a->cy + b->y;
+
+	if (dx && dy)
+		pixel_delay_diag();
+	else
+		pixel_delay();
+
+	return 1;
+}
+
+
+/** Trace a quarter of the ellipse anticlockwise, with the midpoint
+ * algorithm.  It always runs from (0,b) to (a,0) in its own u and v,
+ * which are swapped and flipped to fit the quadrant so that each
+ * quadrant ends where the next one starts.  The decision variables
+ * are scaled by four to stay in integers.
+ */
+static uint8_t
+arc_quadrant(
+	arc_beam_t * const beam,
+	const uint8_t q
+)
+{
+	const vector_arc_t * const arc = beam->a;
+	const uint8_t swap = !(q & 1);
+	const int8_t sx = q == 0 || q == 3 ? 1 : -1;
+	const int8_t sy = q < 2 ? 1 : -1;
+	const uint8_t a = swap ? arc->ry : arc->rx;
+	const uint8_t b = swap ? arc->rx : arc->ry;
+	const int32_t a2 = (int16_t) a * a;
+	const int32_t b2 = (int16_t) b * b;
+
+	// steps in u are +1 and in v are -1
+#define ARC_STEP(du, dv) \
+	(swap \
+		? arc_step(beam, -(dv) * sx, (du) * sy) \
+		: arc_step(beam, (du) * sx, -(dv) * sy))
+
+	uint8_t u = 0;
+	uint8_t v = b;
+	int32_t du = 0;
+	int32_t dv = 2 * a2 * v;
+	int32_t d = 4 * b2 - 4 * a2 * b + a2;
+
+	// where the slope is shallower than -1, step along u
+	while (du < dv)
+	{
+		u++;
+		du += 2 * b2;
+		if (d < 0)
+		{
+			d += 4 * (du + b2);
+			if (!ARC_STEP(1, 0))
+				return 0;
+		} else {
+			v--;
+			dv -= 2 * a2;
+			d += 4 * (du - dv + b2);
+			if (!ARC_STEP(1, 1))
+				return 0;
+		}
+	}
+
+	// and then along v
+	d = b2 * (2 * u + 1) * (2 * u + 1) - 4 * a2 * b2
+		+ 4 * a2 * (v - 1) * (v - 1);
+
+	while (v > 0)
+	{
+		v--;
+		dv -= 2 * a2;
+		if (d > 0)
+		{
+			d += 4 * (a2 - dv);
+			if (!ARC_STEP(0, 1))
+				return 0;
+		} else {
+			u++;
+			du += 2 * b2;
+			d += 4 * (du - dv + a2);
+			if (!ARC_STEP(1, 1))
+				return 0;
+		}
+	}
+
+	// very flat ellipses can end short of the axis
+	while (u < a)
+	{
+		u++;
+		if (!ARC_STEP(1, 0))
+			return 0;
+	}
+
+#undef ARC_STEP
+	return 1;
+}
+
+
+void
+arc(
+	const vector_arc_t * const a
+)
+{
+	if (a->rx == 0 || a->ry == 0)
+	{
+		// nothing to go round; full ellipses become a line and
+		// arcs are not drawn
+		if (a->full)
+			line(a->cx - a->rx, a->cy - a->ry, a->cx + a->rx, a->cy + a->ry);
+		return;
+	}
+
+	arc_beam_t beam = {
+		.a = a,
+		.drawing = 0,
+	};
+
+	for (uint8_t i = 0 ; i < a->quadrants ; i++)
+	{
+		const uint8_t q = (a->q0 + i) & 3;
+
+		// the quadrant starts on an axis
+		beam.x = q == 0 ? a->rx : q == 2 ? -a->rx : 0;
+		beam.y = q == 1 ? a->ry : q == 3 ? -a->ry : 0;
+		beam.check_start = !a->full && i == 0;
+		beam.check_end = !a->full && i == a->quadrants - 1;
+
+		if (!a->full)
+		{
+			beam.cross0 = (int32_t) a->c0 * beam.y - (int32_t) a->s0 * beam.x;
+			beam.cross1 = (int32_t) a->c1 * beam.y - (int32_t) a->s1 * beam.x;
+		}
+
+		if (i == 0 && !arc_step(&beam, 0, 0))
+			return;
+
+		if (!arc_quadrant(&beam, q))
+			return;
+	}
+}
+
+
+void
+ellipse(
+	const uint8_t cx,
+	const uint8_t cy,
+	const uint8_t rx,
+	const uint8_t ry
+)
+{
+	vector_arc_t a;
+	vector_arc_init(&a, cx, cy, rx, ry, 0, 0);
+	arc(&a);
+}
+
+
+void
+circle(
+	const uint8_t cx,
+	const uint8_t cy,
+	const uint8_t r
+)
+{
+	ellipse(cx, cy, r, r);
+}
+
+
+/** Bezier curves are stepped with forward differences in Q30, with
+ * the parameter step a power of two no finer than 2^-BEZIER_MAX_K.
+ * For control points on the screen every difference is then an exact
+ * multiple of 2^-30 at every step, so the beam follows the rounded
+ * curve with no drift and lands exactly on the end point.
+ */
+#define BEZIER_FRAC	30
+#define BEZIER_ONE	((int32_t) 1 << BEZIER_FRAC)
+#define BEZIER_MAX_K	10
+
+
+/** Forward differences along one axis at the current step size */
+typedef struct
+{
+	int32_t f; // position from the beam, -1/2 to 1/2
+	int32_t d1;
+	int32_t d2;
+	int32_t d3;
+} bezier_axis_t;
+
+
+static inline int32_t
+abs32(
+	const int32_t x
+)
+{
+	return x < 0 ? -x : x;
+}
+
+
+/** Differences of a t^3 + b t^2 + c t at t = 0 for a step of 2^-k */
+static void
+bezier_axis_init(
+	bezier_axis_t * const p,
+	const int16_t a,
+	const int16_t b,
+	const int16_t c,
+	const uint8_t k
+)
+{
+	const int32_t a3 = (int32_t) a * ((int32_t) 1 << (BEZIER_FRAC - 3 * k));
+	const int32_t b2 = (int32_t) b * ((int32_t) 1 << (BEZIER_FRAC - 2 * k));
+	const int32_t c1 = (int32_t) c * ((int32_t) 1 << (BEZIER_FRAC - k));
+
+	p->f = 0;
+	p->d1 = a3 + b2 + c1;
+	p->d2 = 6 * a3 + 2 * b2;
+	p->d3 = 6 * a3;
+}
+
+
+/** Halve the step: d3/8, d2/4 - d3/8 and d1/2 - d2/8 + d3/16, each
+ * of which is exact while k stays within BEZIER_MAX_K.
+ */
+static inline void
+bezier_halve(
+	bezier_axis_t * const p
+)
+{
+	const int32_t d3 = p->d3 >> 3;
+	p->d1 = (p->d1 >> 1) - (p->d2 >> 3) + (p->d3 >> 4);
+	p->d2 = (p->d2 >> 2) - d3;
+	p->d3 = d3;
+}
+
+
+/** Double the step: 2 d1 + d2, 4 d2 + 4 d3 and 8 d3 */
+static inline void
+bezier_double(
+	bezier_axis_t * const p
+)
+{
+	p->d1 = 2 * p->d1 + p->d2;
+	p->d2 = 4 * (p->d2 + p->d3);
+	p->d3 = 8 * p->d3;
+}
+
+
+/** Whether doubling would keep the step under a unit.  The second
+ * and third differences are kept small enough that they cannot grow
+ * past two units, and overflow, before the first one forces a halving.
+ */
+static inline uint8_t
+bezier_can_double(
+	const bezier_axis_t * const p
+)
+{
+	return abs32(p->d1) < BEZIER_ONE / 2
+		&& abs32(p->d2) < BEZIER_ONE / 16
+		&& abs32(p->d3) < BEZIER_ONE / 64
+		&& abs32(2 * p->d1 + p->d2) <= BEZIER_ONE;
+}
+
+
+/** Take one step and return -1, 0 or 1 for the move of the beam */
+static inline int8_t
+bezier_step(
+	bezier_axis_t * const p
+)
+{
+	int8_t move = 0;
+
+	p->f += p->d1;
+	p->d1 += p->d2;
+	p->d2 += p->d3;
+
+	if (p->f >= BEZIER_ONE / 2)
+	{
+		p->f -= BEZIER_ONE;
+		move = 1;
+	} else
+	if (p->f < -BEZIER_ONE / 2)
+	{
+		p->f += BEZIER_ONE;
+		move = -1;
+	}
+
+	return move;
+}
+
+
+/** Smallest step of 2^-k where no difference starts over a unit */
+static uint8_t
+bezier_start_k(
+	const int16_t a,
+	const int16_t b,
+	const int16_t c
+)
+{
+	// 6|a| + 2|b| 2^k + |c| 2^2k < 2^3k, scaled up by 2^3k
+	const uint32_t aa = a < 0 ? -a : a;
+	const uint32_t bb = b < 0 ? -b : b;
+	const uint32_t cc = c < 0 ? -c : c;
+	uint8_t k = 0;
+
+	while (k < BEZIER_MAX_K
+	&& 6 * aa + ((2 * bb) << k) + (cc << (2 * k)) >= (uint32_t) 1 << (3 * k))
+		k++;
+
+	return k;
+}
+
+
+/** Step the beam along x(t) = ax t^3 + bx t^2 + cx t + x0, and the
+ * same for y, from t = 0 to 1.  The step size is halved whenever the
+ * next step would move the beam more than a unit along either axis
+ * and doubled when it would move less than half of one, so each step
+ * is about one DAC unit and the inner loop is only adds and shifts.
+ */
+static void
+bezier(
+	const uint8_t x0,
+	const uint8_t y0,
+	const int16_t ax,
+	const int16_t bx,
+	const int16_t cx,
+	const int16_t ay,
+	const int16_t by,
+	const int16_t cy
+)
+{
+	const uint8_t kx = bezier_start_k(ax, bx, cx);
+	const uint8_t ky = bezier_start_k(ay, by, cy);
+	uint8_t k = kx > ky ? kx : ky;
+
+	bezier_axis_t px;
+	bezier_axis_t py;
+	bezier_axis_init(&px, ax, bx, cx, k);
+	bezier_axis_init(&py, ay, by, cy, k);
+
+	uint8_t x = x0;
+	uint8_t y = y0;
+	moveto(x, y);
+
+	// t in units of the finest step
+	uint16_t t = 0;
+	const uint16_t t_end = 1 << BEZIER_MAX_K;
+
+	while (t < t_end)
+	{
+		while (k < BEZIER_MAX_K
+		&& (abs32(px.d1) > BEZIER_ONE || abs32(py.d1) > BEZIER_ONE))
+		{
+			bezier_halve(&px);
+			bezier_halve(&py);
+			k++;
+		}
+
+		// only double on an even step, so t still lands on the end
+		while (k > 0
+		&& (t & ((1 << (BEZIER_MAX_K - k + 1)) - 1)) == 0
+		&& bezier_can_double(&px)
+		&& bezier_can_double(&py))
+		{
+			bezier_double(&px);
+			bezier_double(&py);
+			k--;
+		}
+
+		const int8_t dx = bezier_step(&px);
+		const int8_t dy = bezier_step(&py);
+		t += 1 << (BEZIER_MAX_K - k);
+
+		if (dx)
+			PORTB = x += dx;
+		if (dy)
+			PORTD = y += dy;
+
+		if (dx && dy)
+			pixel_delay_diag();
+		else
+		if (dx || dy)
+			pixel_delay();
+	}
+}
+
+
+void
+bezier_quad(
+	const uint8_t x0,
+	const uint8_t y0,
+	const uint8_t x1,
+	const uint8_t y1,
+	const uint8_t x2,
+	const uint8_t y2
+)
+{
+	bezier(x0, y0,
+		0, x0 - 2 * x1 + x2, 2 * (x1 - x0),
+		0, y0 - 2 * y1 + y2, 2 * (y1 - y0)
+	);
+}
+
+
+void
+bezier_cubic(
+	const uint8_t x0,
+	const uint8_t y0,
+	const uint8_t x1,
+	const uint8_t y1,
+	const uint8_t x2,
+	const uint8_t y2,
+	const uint8_t x3,
+	const uint8_t y3
+)
+{
+	bezier(x0, y0,
+		x3 - x0 + 3 * (x1 - x2), 3 * (x0 - 2 * x1 + x2), 3 * (x1 - x0),
+		y3 - y0 + 3 * (y1 - y2), 3 * (y0 - 2 * y1 + y2), 3 * (y1 - y0)
+	);
+}
+
+
+void
+bezier_path(
+	const uint8_t * p,
+	uint8_t segments
+)
+{
+	uint8_t x = pgm_read_byte(p++);
+	uint8_t y = pgm_read_byte(p++);
+
+	while (segments--)
+	{
+		const uint8_t x1 = pgm_read_byte(p++);
+		const uint8_t y1 = pgm_read_byte(p++);
+		const uint8_t x2 = pgm_read_byte(p++);
+		const uint8_t y2 = pgm_read_byte(p++);
+		const uint8_t x3 = pgm_read_byte(p++);
+		const uint8_t y3 = pgm_read_byte(p++);
+
+		bezier_cubic(x, y, x1, y1, x2, y2, x3, y3);
+		x = x3;
+		y = y3;
+	}
+}
+
+
 
 void
 vector_rot_init(
@@ -286,79 +863,265 @@ scaling(
 
 
 
+#ifdef CONFIG_HERSHEY
+#define DEFAULT_FONT FONT_HERSHEY_SIMPLEX
+#else
+#define DEFAULT_FONT FONT_ASTEROIDS
+#endif
+
+/** The transform of a vector_rot_t for a glyph drawn at (x,y).
+ * vector_rot_t turns clockwise, and a scale of 64 is full size.
+ */
+static void
+rot_xform(
+	const vector_rot_t * const r,
+	const int8_t x,
+	const int8_t y,
+	xform_t * const m
+)
+{
+	xform_identity(m);
+	xform_translate(m, x, y);
+	xform_scale(m, r->scale * 4, r->scale * 4);
+	if (r->theta != 0)
+		xform_rotate(m, -((uint16_t) r->theta << 8));
+	xform_translate(m, r->cx, r->cy);
+}
+
+
+/** Check if a box in screen coordinates misses the viewport */
 static inline uint8_t
-_draw_char(
-	const uint8_t x,
-	const uint8_t y,
-	uint8_t c,
-	const uint8_t scale
+offscreen(
+	const int16_t x0,
+	const int16_t y0,
+	const int16_t x1,
+	const int16_t y1
 )
 {
-	uint8_t ox = x;
-	uint8_t oy = y;
-	uint8_t pen_down = 0;
+	return x1 < 0 || x0 > 255 || y1 < 0 || y0 > 255;
+}
 
-	if (c < 0x20)
-		return 0;
 
-#ifdef CONFIG_HERSHEY
-	const hershey_char_t * p = &hershey_simplex[c - 0x20];
-	const uint8_t count = pgm_read_byte(&p->count);
+/** Check if a rotated glyph box is entirely off screen by
+ * transforming its four corners.
+ */
+static uint8_t
+glyph_rot_offscreen(
+	const glyph_bbox_t * const bb,
+	const xform_t * const m
+)
+{
+	int16_t x0 = INT16_MAX;
+	int16_t y0 = INT16_MAX;
+	int16_t x1 = INT16_MIN;
+	int16_t y1 = INT16_MIN;
+
+	for (uint8_t i = 0 ; i < 4 ; i++)
+	{
+		const vec2_t p = xform_apply(m, (vec2_t) {
+			i & 1 ? bb->x1 : bb->x0,
+			i & 2 ? bb->y1 : bb->y0,
+		});
+
+		if (p.x < x0) x0 = p.x;
+		if (p.x > x1) x1 = p.x;
+		if (p.y < y0) y0 = p.y;
+		if (p.y > y1) y1 = p.y;
+	}
+
+	return offscreen(x0, y0, x1, y1);
+}
+
+
+/** n / d rounded to the nearest */
+static int16_t
+clip_div(
+	int32_t n,
+	int32_t d
+)
+{
+	if (d < 0)
+	{
+		n = -n;
+		d = -d;
+	}
+
+	return (n < 0 ? n - d / 2 : n + d / 2) / d;
+}
 
-	for (uint8_t i = 0 ; i < count ; i++)
+
+/** The crossings are always found from the original line, so that
+ * rounding one does not tilt the next.
+ */
+uint8_t
+line_clip(
+	int16_t * const x0,
+	int16_t * const y0,
+	uint8_t c0,
+	int16_t * const x1,
+	int16_t * const y1,
+	uint8_t c1
+)
+{
+	const int16_t ox = *x0;
+	const int16_t oy = *y0;
+	const int32_t dx = *x1 - ox;
+	const int32_t dy = *y1 - oy;
+
+	while (1)
 	{
-		const int8_t px = pgm_read_byte(&p->points[i*2+0]);
-		const int8_t py = pgm_read_byte(&p->points[i*2+1]);
-		if (px == -1 && py == -1)
+		if ((c0 | c1) == 0)
+			return 1;
+		if (c0 & c1)
+			return 0;
+
+		// move whichever end is off the screen to the edge of it
+		const uint8_t c = c0 ? c0 : c1;
+		int16_t x;
+		int16_t y;
+
+		if (c & CLIP_TOP)
 		{
-			pen_down = 0;
-			continue;
+			x = ox + clip_div(dx * (255 - oy), dy);
+			y = 255;
+		} else
+		if (c & CLIP_BOTTOM)
+		{
+			x = ox + clip_div(dx * (0 - oy), dy);
+			y = 0;
+		} else
+		if (c & CLIP_RIGHT)
+		{
+			y = oy + clip_div(dy * (255 - ox), dx);
+			x = 255;
+		} else {
+			y = oy + clip_div(dy * (0 - ox), dx);
+			x = 0;
+		}
+
+		if (c == c0)
+		{
+			*x0 = x;
+			*y0 = y;
+			c0 = clip_code(x, y);
+		} else {
+			*x1 = x;
+			*y1 = y;
+			c1 = clip_code(x, y);
 		}
+	}
+}
+
+
+void
+line_clipped(
+	int16_t x0,
+	int16_t y0,
+	int16_t x1,
+	int16_t y1
+)
+{
+	if (line_clip(&x0, &y0, clip_code(x0, y0), &x1, &y1, clip_code(x1, y1)))
+		line(x0, y0, x1, y1);
+}
 
-		const uint8_t nx = x + scaling(px, scale);
-		const uint8_t ny = y + scaling(py, scale);
 
-		if (pen_down)
-			line(ox, oy, nx, ny);
+/** Draw the strokes of a glyph, translated and scaled to the screen.
+ * The points are scaled as they are drawn rather than into a buffer,
+ * to keep the stack small, and strokes that cross the edge of the
+ * screen are clipped.
+ */
+static void
+glyph_stroke(
+	const glyph_t * const g,
+	const int16_t x,
+	const int16_t y,
+	const uint8_t scale
+)
+{
+	int16_t x0 = 0;
+	int16_t y0 = 0;
 
-		pen_down = 1;
-		ox = nx;
-		oy = ny;
+	for (uint8_t i = 0 ; i < g->count ; i++)
+	{
+		const int16_t x1 = x + scaling(g->x[i], scale);
+		const int16_t y1 = y + scaling(g->y[i], scale);
+
+		if (!glyph_pen_up(g, i))
+			line_clipped(x0, y0, x1, y1);
+
+		x0 = x1;
+		y0 = y1;
 	}
+}
 
-	const uint8_t width = pgm_read_byte(&p->width);
-	return scaling(width, scale);
-#else
-	if ('a' <= c && c <= 'z')
-		c += 'A' - 'a';
 
-	const asteroids_char_t * const p = &asteroids_font[c - 0x20];
-	for (uint8_t i = 0 ; i < 8 ; i++)
+/** Points of a glyph transformed at a time by glyph_stroke_xform() */
+#define GLYPH_XFORM_BATCH 8
+
+
+/** Draw the strokes of a glyph through a transform.
+ * The points go through xform_points8() a batch at a time into a
+ * small buffer, which keeps the previous batch's last point in p[0]
+ * so that strokes continue across batches.
+ */
+static void
+glyph_stroke_xform(
+	const glyph_t * const g,
+	const xform_t * const m
+)
+{
+	vec2_t p[GLYPH_XFORM_BATCH + 1];
+	p[0] = (vec2_t) { 0, 0 };
+
+	for (uint8_t i = 0 ; i < g->count ; i += GLYPH_XFORM_BATCH)
 	{
-		const uint8_t xy = pgm_read_byte(&p->points[i]);
-		if (xy == 0xFF)
-			break;
-		if (xy == 0xFE)
+		uint8_t n = g->count - i;
+		if (n > GLYPH_XFORM_BATCH)
+			n = GLYPH_XFORM_BATCH;
+
+		xform_points8(m, &g->x[i], &g->y[i], n, &p[1]);
+
+		for (uint8_t j = 0 ; j < n ; j++)
 		{
-			pen_down = 0;
-			continue;
+			if (!glyph_pen_up(g, i + j))
+				line_clipped(p[j].x, p[j].y, p[j + 1].x, p[j + 1].y);
 		}
 
-		const int8_t px = ((xy >> 4) & 0xF) * 2;
-		const int8_t py = ((xy >> 0) & 0xF) * 2;
-		const uint8_t nx = x + scaling(px, scale);
-		const uint8_t ny = y + scaling(py, scale);
+		p[0] = p[n];
+	}
+}
 
-		if (pen_down)
-			line(ox, oy, nx, ny);
 
-		pen_down = 1;
-		ox = nx;
-		oy = ny;
-	}
+static inline uint8_t
+_draw_char(
+	const font_t font,
+	const int16_t x,
+	const int16_t y,
+	uint8_t c,
+	const uint8_t scale
+)
+{
+	glyph_bbox_t bb;
 
-	return scaling(20, scale);
-#endif
+	const uint8_t advance = font_bbox(font, c, &bb);
+	if (!advance)
+		return 0;
+
+	const uint8_t width = scaling(advance, scale);
+
+	// Skip glyphs that are entirely off screen before decoding them
+	if (bb.x1 < bb.x0 || offscreen(
+		x + scaling(bb.x0, scale),
+		y + scaling(bb.y0, scale),
+		x + scaling(bb.x1, scale),
+		y + scaling(bb.y1, scale)
+	))
+		return width;
+
+	glyph_stroke(font_glyph(font, c, scale), x, y, scale);
+
+	return width;
 }
 
 
@@ -369,7 +1132,7 @@ draw_char_big(
 	uint8_t c
 )
 {
-	return _draw_char(x, y, c, 3);
+	return _draw_char(DEFAULT_FONT, x, y, c, 3);
 }
 
 
@@ -380,7 +1143,7 @@ draw_char_med(
 	uint8_t c
 )
 {
-	return _draw_char(x, y, c, 2);
+	return _draw_char(DEFAULT_FONT, x, y, c, 2);
 }
 
 uint8_t
@@ -390,56 +1153,118 @@ draw_char_small(
 	uint8_t c
 )
 {
-	return _draw_char(x, y, c, 1);
+	return _draw_char(DEFAULT_FONT, x, y, c, 1);
 }
 
 
-void
-draw_char_rot(
-	const vector_rot_t * const r,
-	const int8_t x,
-	const int8_t y,
-	char c
+int16_t
+draw_string(
+	const font_t font,
+	int16_t x,
+	const int16_t y,
+	const char * s,
+	const uint8_t scale
 )
 {
-	// we never use the original points since the lines always
-	// start pen-up
-	uint8_t ox = 0; // vector_rot_x(r, x, y);
-	uint8_t oy = 0; // vector_rot_y(r, x, y);
-	uint8_t pen_down = 0;
+	const int16_t x0 = x;
+	char c;
 
-	if (c < 0x20)
-		return;
+	while ((c = *s++))
+		x += _draw_char(font, x, y, c, scale);
+
+	return x - x0;
+}
 
-	if ('a' <= c && c <= 'z')
-		c += 'A' - 'a';
 
-	const asteroids_char_t * const p = &asteroids_font[c - 0x20];
-	for (uint8_t i = 0 ; i < 8 ; i++)
+int16_t
+string_bbox(
+	const font_t font,
+	const char * s,
+	const uint8_t scale,
+	text_bbox_t * const bbox
+)
+{
+	int16_t x = 0;
+	uint8_t empty = 1;
+	char c;
+
+	while ((c = *s++))
 	{
-		const uint8_t xy = pgm_read_byte(&p->points[i]);
-		if (xy == 0xFF)
-			break;
-		if (xy == 0xFE)
-		{
-			pen_down = 0;
+		glyph_bbox_t bb;
+		const uint8_t width = font_bbox(font, c, &bb);
+		if (!width)
 			continue;
+
+		if (bbox && bb.x0 <= bb.x1)
+		{
+			const int16_t x0 = x + scaling(bb.x0, scale);
+			const int16_t y0 = scaling(bb.y0, scale);
+			const int16_t x1 = x + scaling(bb.x1, scale);
+			const int16_t y1 = scaling(bb.y1, scale);
+
+			if (empty || x0 < bbox->x0) bbox->x0 = x0;
+			if (empty || y0 < bbox->y0) bbox->y0 = y0;
+			if (empty || x1 > bbox->x1) bbox->x1 = x1;
+			if (empty || y1 > bbox->y1) bbox->y1 = y1;
+			empty = 0;
 		}
 
-		const int8_t px = ((xy >> 4) & 0xF) * 2;
-		const int8_t py = ((xy >> 0) & 0xF) * 2;
+		x += scaling(width, scale);
+	}
+
+	if (bbox && empty)
+	{
+		bbox->x0 = bbox->y0 = 0;
+		bbox->x1 = bbox->y1 = -1;
+	}
 
-		const int8_t nx = x + px;
-		const int8_t ny = y + py;
-		const uint8_t rx = vector_rot_x(r, nx, ny);
-		const uint8_t ry = vector_rot_y(r, nx, ny);
+	return x;
+}
 
-		if (pen_down)
-			line(ox, oy, rx, ry);
 
-		pen_down = 1;
-		ox = rx;
-		oy = ry;
-	}
+int16_t
+string_width(
+	const font_t font,
+	const char * s,
+	const uint8_t scale
+)
+{
+	return string_bbox(font, s, scale, NULL);
+}
+
+
+void
+draw_char_rot_font(
+	const vector_rot_t * const r,
+	const font_t font,
+	const int8_t x,
+	const int8_t y,
+	char c
+)
+{
+	// Pick the level of detail that matches the scaling() factors
+	const uint8_t lod = r->scale <= 16 ? 0 : r->scale <= 42 ? 1 : 2;
+
+	glyph_bbox_t bb;
+	if (!font_bbox(font, c, &bb) || bb.x1 < bb.x0)
+		return;
+
+	xform_t m;
+	rot_xform(r, x, y, &m);
+	if (glyph_rot_offscreen(&bb, &m))
+		return;
+
+	glyph_stroke_xform(font_glyph(font, c, lod), &m);
 }
 
+
+void
+draw_char_rot(
+	const vector_rot_t * const r,
+	const int8_t x,
+	const int8_t y,
+	char c
+)
+{
+	draw_char_rot_font(r, FONT_ASTEROIDS, x, y, c);
+}
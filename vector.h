@@ -8,6 +8,7 @@
 #define _vector_h_
 
 #include <stdint.h>
+#include "font.h"
 
 
 void
@@ -34,6 +35,181 @@ line(
 );
 
 
+/** Out codes of a point, one bit for each edge of the screen that
+ * it is beyond.
+ */
+#define CLIP_LEFT	0x01
+#define CLIP_RIGHT	0x02
+#define CLIP_BOTTOM	0x04
+#define CLIP_TOP	0x08
+
+static inline uint8_t
+clip_code(
+	const int16_t x,
+	const int16_t y
+)
+{
+	uint8_t code = 0;
+	if (x < 0)
+		code |= CLIP_LEFT;
+	else
+	if (x > 255)
+		code |= CLIP_RIGHT;
+
+	if (y < 0)
+		code |= CLIP_BOTTOM;
+	else
+	if (y > 255)
+		code |= CLIP_TOP;
+
+	return code;
+}
+
+
+/** Clip a line to the screen in the Cohen-Sutherland way.
+ * c0 and c1 are the clip_code() of the ends, which are moved onto the
+ * edge of the screen.  Returns 0 if none of the line is on the screen.
+ * The ends must be within 8192 steps of the screen for the products
+ * to fit in 32 bits.
+ */
+uint8_t
+line_clip(
+	int16_t * x0,
+	int16_t * y0,
+	uint8_t c0,
+	int16_t * x1,
+	int16_t * y1,
+	uint8_t c1
+);
+
+
+/** Draw the part of a line that is on the screen */
+void
+line_clipped(
+	int16_t x0,
+	int16_t y0,
+	int16_t x1,
+	int16_t y1
+);
+
+
+/** Largest radius of an arc, so that the error terms fit in 32 bits */
+#define VECTOR_ARC_MAX	127
+
+
+/** An arc of an axis aligned ellipse, set up by vector_arc_init() so
+ * that drawing it needs no trigonometry.
+ */
+typedef struct
+{
+	uint8_t cx;
+	uint8_t cy;
+	uint8_t rx;
+	uint8_t ry;
+
+	// quadrant of the start, how many are visited and whether
+	// it goes all the way round
+	uint8_t q0;
+	uint8_t quadrants;
+	uint8_t full;
+
+	// directions of the ends, Q14
+	int16_t c0;
+	int16_t s0;
+	int16_t c1;
+	int16_t s1;
+} vector_arc_t;
+
+
+/** Set up an arc anticlockwise from the start to the end angle.
+ *
+ * Angles are 16-bit as fix_sin(), with 0 along +x, and are those of
+ * the rays from the centre, so for ellipses they are not the same as
+ * the parametric angle.  If they are equal the whole ellipse is
+ * drawn.  Radii are clamped to VECTOR_ARC_MAX, and the arc must fit
+ * on the screen.
+ */
+void
+vector_arc_init(
+	vector_arc_t * a,
+	uint8_t cx,
+	uint8_t cy,
+	uint8_t rx,
+	uint8_t ry,
+	uint16_t start,
+	uint16_t end
+);
+
+
+/** Draw an arc by stepping the beam round it with the midpoint
+ * algorithm, one unit straight or diagonally at a time.  Diagonal
+ * steps wait longer, so the beam moves at a constant speed.
+ */
+void
+arc(
+	const vector_arc_t * a
+);
+
+
+void
+ellipse(
+	uint8_t cx,
+	uint8_t cy,
+	uint8_t rx,
+	uint8_t ry
+);
+
+
+void
+circle(
+	uint8_t cx,
+	uint8_t cy,
+	uint8_t r
+);
+
+
+/** Quadratic and cubic Bezier curves through their control points.
+ *
+ * The beam is stepped with adaptive forward differencing, so each
+ * step moves about one unit and costs only adds and shifts, and like
+ * arc() the diagonal steps wait longer.  The curve ends exactly on
+ * the last control point.
+ */
+void
+bezier_quad(
+	uint8_t x0,
+	uint8_t y0,
+	uint8_t x1,
+	uint8_t y1,
+	uint8_t x2,
+	uint8_t y2
+);
+
+
+void
+bezier_cubic(
+	uint8_t x0,
+	uint8_t y0,
+	uint8_t x1,
+	uint8_t y1,
+	uint8_t x2,
+	uint8_t y2,
+	uint8_t x3,
+	uint8_t y3
+);
+
+
+/** Draw a chain of cubic curves from program memory.  The points are
+ * x and y bytes: the start, then three more for each segment, the
+ * last of which starts the next one.
+ */
+void
+bezier_path(
+	const uint8_t * p,
+	uint8_t segments
+);
+
+
 typedef struct
 {
 	// center of rotation
@@ -97,6 +273,58 @@ draw_char_small(
 );
 
 
+/** Draw a string in any font and return its width.
+ *
+ * scale selects the size: 0 is 1/4, 1 is 2/3, 2 is full size,
+ * 3 is 3/2 and 4 is double the font units.  The string may start
+ * or run off the screen; glyphs that are entirely outside of it
+ * are skipped and those that cross the edge are clipped.
+ */
+int16_t
+draw_string(
+	font_t font,
+	int16_t x,
+	int16_t y,
+	const char * s,
+	uint8_t scale
+);
+
+
+/** Extents of the ink of a string, relative to its origin */
+typedef struct
+{
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+} text_bbox_t;
+
+
+/** Measure a string without drawing it.
+ *
+ * Returns the advance width that draw_string() would return and,
+ * if bbox is not NULL, fills in the extents of the drawn strokes.
+ * An empty string has x1 < x0.
+ */
+int16_t
+string_bbox(
+	font_t font,
+	const char * s,
+	uint8_t scale,
+	text_bbox_t * bbox
+);
+
+
+/** Advance width of a string, for centering and right alignment */
+int16_t
+string_width(
+	font_t font,
+	const char * s,
+	uint8_t scale
+);
+
+
+/** Draw a rotated and scaled character from the asteroids font */
 void
 draw_char_rot(
 	const vector_rot_t * const r,
@@ -105,4 +333,15 @@ draw_char_rot(
 	char val
 );
 
+
+/** Draw a rotated and scaled character from any font */
+void
+draw_char_rot_font(
+	const vector_rot_t * const r,
+	font_t font,
+	int8_t x,
+	int8_t y,
+	char val
+);
+
 #endif
@@ -0,0 +1,179 @@
+/** \file
+ * World to screen transform with zoom and pan.
+ *
+ * All of the divisions are in viewport_update(), which only runs
+ * when the view changes.
+ */
+#include <stdint.h>
+#include "viewport.h"
+
+
+/** Screen position of a world coordinate along one axis, the same
+ * as xform_apply() with b and c of 0.
+ */
+static int32_t
+axis_map(
+	const int16_t w,
+	const xform_t * const m,
+	const int16_t t
+)
+{
+	return (((int32_t) m->a * w + xform_half(m)) >> m->shift) + t;
+}
+
+
+/** Smallest and largest world coordinate that map to 0 to
+ * VIEWPORT_MAX, clamped to the 16-bit range.  The Q16 scale gives a
+ * first guess, within a unit or two of the normalised transform,
+ * which is then nudged until it maps exactly.  t is within
+ * VIEWPORT_LIMIT of the screen, so the products fit in 32 bits.
+ */
+static void
+axis_bounds(
+	const xform_t * const m,
+	const uint16_t scale,
+	const int16_t t,
+	int16_t * const lo,
+	int16_t * const hi
+)
+{
+	int32_t w0 = (int32_t) -t * 65536 / scale;
+	int32_t w1 = (int32_t) (VIEWPORT_MAX - t) * 65536 / scale;
+
+	if (w0 < INT16_MIN)
+		w0 = INT16_MIN;
+	if (w0 > INT16_MAX)
+		w0 = INT16_MAX;
+	if (w1 < INT16_MIN)
+		w1 = INT16_MIN;
+	if (w1 > INT16_MAX)
+		w1 = INT16_MAX;
+
+	while (w0 < INT16_MAX && axis_map(w0, m, t) < 0)
+		w0++;
+	while (w0 > INT16_MIN && axis_map(w0 - 1, m, t) >= 0)
+		w0--;
+
+	while (w1 > INT16_MIN && axis_map(w1, m, t) > VIEWPORT_MAX)
+		w1--;
+	while (w1 < INT16_MAX && axis_map(w1 + 1, m, t) <= VIEWPORT_MAX)
+		w1++;
+
+	*lo = w0;
+	*hi = w1;
+}
+
+
+void
+viewport_update(
+	viewport_t * const v
+)
+{
+	if (v->zoom < VIEWPORT_ZOOM_MIN)
+		v->zoom = VIEWPORT_ZOOM_MIN;
+	if (v->zoom > VIEWPORT_ZOOM_MAX)
+		v->zoom = VIEWPORT_ZOOM_MAX;
+
+	if (v->cx < -VIEWPORT_LIMIT) v->cx = -VIEWPORT_LIMIT;
+	if (v->cx > VIEWPORT_LIMIT) v->cx = VIEWPORT_LIMIT;
+	if (v->cy < -VIEWPORT_LIMIT) v->cy = -VIEWPORT_LIMIT;
+	if (v->cy > VIEWPORT_LIMIT) v->cy = VIEWPORT_LIMIT;
+
+	// sqrt(2) is 181 / 128 to within 0.01%
+	uint32_t scale = v->base;
+	const uint8_t half = v->zoom < 0 ? -v->zoom : v->zoom;
+	if (v->zoom >= 0)
+	{
+		scale <<= half / 2;
+		if (half & 1)
+			scale = (scale * 181) / 128;
+	} else {
+		scale >>= half / 2;
+		if (half & 1)
+			scale = (scale * 128) / 181;
+	}
+
+	if (scale > UINT16_MAX)
+		scale = UINT16_MAX;
+	if (scale == 0)
+		scale = 1;
+	v->scale = scale;
+
+	// scale, then move the centre to pixel 128
+	xform_t * const m = &v->m;
+	xform_set(m, v->scale, 0, 0, v->scale, 16);
+	m->tx = m->ty = 0;
+	const vec2_t c = xform_apply(m, (vec2_t) { v->cx, v->cy });
+	m->tx = 128 - c.x;
+	m->ty = 128 - c.y;
+
+	axis_bounds(m, v->scale, m->tx, &v->x0, &v->x1);
+	axis_bounds(m, v->scale, m->ty, &v->y0, &v->y1);
+}
+
+
+void
+viewport_init(
+	viewport_t * const v,
+	const int16_t cx,
+	const int16_t cy,
+	const uint16_t base
+)
+{
+	v->cx = cx;
+	v->cy = cy;
+	v->base = base;
+	v->zoom = 0;
+	viewport_update(v);
+}
+
+
+void
+viewport_zoom(
+	viewport_t * const v,
+	const int8_t steps
+)
+{
+	v->zoom += steps;
+	viewport_update(v);
+}
+
+
+void
+viewport_pan(
+	viewport_t * const v,
+	const int8_t dx,
+	const int8_t dy
+)
+{
+	int32_t cx = v->cx + ((int32_t) dx << 16) / v->scale;
+	int32_t cy = v->cy + ((int32_t) dy << 16) / v->scale;
+
+	// viewport_update() clamps them the rest of the way
+	v->cx = cx < INT16_MIN ? INT16_MIN : cx > INT16_MAX ? INT16_MAX : cx;
+	v->cy = cy < INT16_MIN ? INT16_MIN : cy > INT16_MAX ? INT16_MAX : cy;
+	viewport_update(v);
+}
+
+
+uint8_t
+viewport_map(
+	const viewport_t * const v,
+	const int16_t * const wx,
+	const int16_t * const wy,
+	const uint8_t n,
+	uint8_t * const sx,
+	uint8_t * const sy,
+	uint8_t * const on
+)
+{
+	uint8_t count = 0;
+
+	for (uint8_t i = 0 ; i < n ; i++)
+	{
+		on[i] = viewport_point(v, wx[i], wy[i], &sx[i], &sy[i]);
+		count += on[i];
+	}
+
+	return count;
+}
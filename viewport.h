@@ -0,0 +1,118 @@
+/** \file
+ * World to screen transform with zoom and pan.
+ *
+ * World positions are 16-bit in whatever unit the caller uses.  The
+ * scale is a Q16 number of pixels per world unit, and each zoom step
+ * is a factor of the square root of two.  Changing the zoom or the
+ * centre recomputes the transform and the visible bounds in world
+ * units, so mapping a point is two compares per axis to cull it and
+ * then an xform_apply(), with no division or float.
+ */
+#ifndef _viewport_h_
+#define _viewport_h_
+
+#include <stdint.h>
+#include "xform.h"
+
+/** Largest screen coordinate that is drawn */
+#define VIEWPORT_MAX		250
+
+#define VIEWPORT_ZOOM_MIN	-8
+#define VIEWPORT_ZOOM_MAX	8
+
+/** The centre stays within this, so the offsets fit in 16 bits */
+#define VIEWPORT_LIMIT		16384
+
+
+typedef struct
+{
+	// set with viewport_init(), viewport_zoom() and viewport_pan()
+	int16_t cx; // world position at the centre of the screen
+	int16_t cy;
+	uint16_t base; // pixels per unit at zoom 0, Q16
+	int8_t zoom;
+
+	// cached by viewport_update()
+	uint16_t scale; // pixels per unit, Q16
+	xform_t m;
+	int16_t x0; // visible world bounds, inclusive
+	int16_t x1;
+	int16_t y0;
+	int16_t y1;
+} viewport_t;
+
+
+extern void
+viewport_init(
+	viewport_t * v,
+	int16_t cx,
+	int16_t cy,
+	uint16_t base
+);
+
+
+/** Recompute the cached transform after changing the fields */
+extern void
+viewport_update(
+	viewport_t * v
+);
+
+
+/** Zoom in by the given number of steps, or out if negative,
+ * keeping the centre of the screen where it is.
+ */
+extern void
+viewport_zoom(
+	viewport_t * v,
+	int8_t steps
+);
+
+
+/** Move the view by a number of pixels at the current zoom */
+extern void
+viewport_pan(
+	viewport_t * v,
+	int8_t dx,
+	int8_t dy
+);
+
+
+/** Map a world position to the screen.
+ * Returns 0 if it is off the screen.
+ */
+static inline uint8_t
+viewport_point(
+	const viewport_t * const v,
+	const int16_t wx,
+	const int16_t wy,
+	uint8_t * const sx,
+	uint8_t * const sy
+)
+{
+	if (wx < v->x0 || wx > v->x1 || wy < v->y0 || wy > v->y1)
+		return 0;
+
+	const vec2_t p = xform_apply(&v->m, (vec2_t) { wx, wy });
+	*sx = p.x;
+	*sy = p.y;
+	return 1;
+}
+
+
+/** Map n world positions at once.
+ * on[i] is set to whether each one is on the screen, and the number
+ * that are is returned.
+ */
+extern uint8_t
+viewport_map(
+	const viewport_t * v,
+	const int16_t * wx,
+	const int16_t * wy,
+	uint8_t n,
+	uint8_t * sx,
+	uint8_t * sy,
+	uint8_t * on
+);
+
+
+#endif
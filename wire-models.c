@@ -0,0 +1,223 @@
+/** \file
+ * Built in wireframe models.
+ */
+#include <stdint.h>
+#include "wire3d.h"
+#include "memspaces.h"
+
+
+/** A cube 128 units on a side.  Each edge is between two faces, so
+ * only the three or fewer faces towards the viewer are drawn.
+ */
+static const wire_vertex_t PROGMEM cube_vertices[WIRE_CUBE_VERTICES] = {
+	{ -64, -64, -64 },
+	{ 64, -64, -64 },
+	{ -64, 64, -64 },
+	{ 64, 64, -64 },
+	{ -64, -64, 64 },
+	{ 64, -64, 64 },
+	{ -64, 64, 64 },
+	{ 64, 64, 64 },
+};
+
+static const wire_edge_t PROGMEM cube_edges[] = {
+	{ 0, 1, 2, 4 },
+	{ 1, 3, 1, 4 },
+	{ 3, 2, 3, 4 },
+	{ 2, 0, 0, 4 },
+	{ 4, 5, 2, 5 },
+	{ 5, 7, 1, 5 },
+	{ 7, 6, 3, 5 },
+	{ 6, 4, 0, 5 },
+	{ 0, 4, 0, 2 },
+	{ 1, 5, 1, 2 },
+	{ 2, 6, 0, 3 },
+	{ 3, 7, 1, 3 },
+};
+
+static const wire_face_t PROGMEM cube_faces[] = {
+	{ 0, 2, 6 },
+	{ 5, 7, 3 },
+	{ 4, 5, 1 },
+	{ 2, 3, 7 },
+	{ 0, 1, 3 },
+	{ 6, 7, 5 },
+};
+
+
+const wire_model_t PROGMEM wire_cube = {
+	.vertices = cube_vertices,
+	.edges = cube_edges,
+	.faces = cube_faces,
+	.num_vertices = sizeof(cube_vertices) / sizeof(*cube_vertices),
+	.num_edges = sizeof(cube_edges) / sizeof(*cube_edges),
+	.num_faces = sizeof(cube_faces) / sizeof(*cube_faces),
+};
+
+
+/** "ALERT!" in the asteroids font at twice size, as a slab 12 units
+ * deep.  The strokes on the front and back are drawn only when that
+ * side faces the viewer, so the text never shows mirrored through
+ * itself; the edges between the two sides are always drawn.  The faces use vertices far apart
+ * so that the test stays good until the text is close to edge on.
+ */
+static const wire_vertex_t PROGMEM alert_vertices[WIRE_ALERT_VERTICES] = {
+	{ -65, -12, -6 },
+	{ -65, 4, -6 },
+	{ -57, 12, -6 },
+	{ -49, 4, -6 },
+	{ -49, -12, -6 },
+	{ -65, -4, -6 },
+	{ -49, -4, -6 },
+	{ -25, -12, -6 },
+	{ -41, -12, -6 },
+	{ -41, 12, -6 },
+	{ -1, -12, -6 },
+	{ -17, -12, -6 },
+	{ -17, 12, -6 },
+	{ -1, 12, -6 },
+	{ -17, 0, -6 },
+	{ -5, 0, -6 },
+	{ 7, -12, -6 },
+	{ 7, 12, -6 },
+	{ 23, 12, -6 },
+	{ 23, 0, -6 },
+	{ 7, -2, -6 },
+	{ 15, -2, -6 },
+	{ 23, -12, -6 },
+	{ 31, 12, -6 },
+	{ 47, 12, -6 },
+	{ 39, 12, -6 },
+	{ 39, -12, -6 },
+	{ 63, -12, -6 },
+	{ 61, -8, -6 },
+	{ 65, -8, -6 },
+	{ 63, -4, -6 },
+	{ 63, 12, -6 },
+	{ -65, -12, 6 },
+	{ -65, 4, 6 },
+	{ -57, 12, 6 },
+	{ -49, 4, 6 },
+	{ -49, -12, 6 },
+	{ -65, -4, 6 },
+	{ -49, -4, 6 },
+	{ -25, -12, 6 },
+	{ -41, -12, 6 },
+	{ -41, 12, 6 },
+	{ -1, -12, 6 },
+	{ -17, -12, 6 },
+	{ -17, 12, 6 },
+	{ -1, 12, 6 },
+	{ -17, 0, 6 },
+	{ -5, 0, 6 },
+	{ 7, -12, 6 },
+	{ 7, 12, 6 },
+	{ 23, 12, 6 },
+	{ 23, 0, 6 },
+	{ 7, -2, 6 },
+	{ 15, -2, 6 },
+	{ 23, -12, 6 },
+	{ 31, 12, 6 },
+	{ 47, 12, 6 },
+	{ 39, 12, 6 },
+	{ 39, -12, 6 },
+	{ 63, -12, 6 },
+	{ 61, -8, 6 },
+	{ 65, -8, 6 },
+	{ 63, -4, 6 },
+	{ 63, 12, 6 },
+};
+
+static const wire_edge_t PROGMEM alert_edges[] = {
+	{ 0, 1, 0, WIRE_NO_FACE },
+	{ 1, 2, 0, WIRE_NO_FACE },
+	{ 2, 3, 0, WIRE_NO_FACE },
+	{ 3, 4, 0, WIRE_NO_FACE },
+	{ 5, 6, 0, WIRE_NO_FACE },
+	{ 7, 8, 0, WIRE_NO_FACE },
+	{ 8, 9, 0, WIRE_NO_FACE },
+	{ 10, 11, 0, WIRE_NO_FACE },
+	{ 11, 12, 0, WIRE_NO_FACE },
+	{ 12, 13, 0, WIRE_NO_FACE },
+	{ 14, 15, 0, WIRE_NO_FACE },
+	{ 16, 17, 0, WIRE_NO_FACE },
+	{ 17, 18, 0, WIRE_NO_FACE },
+	{ 18, 19, 0, WIRE_NO_FACE },
+	{ 19, 20, 0, WIRE_NO_FACE },
+	{ 21, 22, 0, WIRE_NO_FACE },
+	{ 23, 24, 0, WIRE_NO_FACE },
+	{ 25, 26, 0, WIRE_NO_FACE },
+	{ 27, 28, 0, WIRE_NO_FACE },
+	{ 28, 29, 0, WIRE_NO_FACE },
+	{ 29, 27, 0, WIRE_NO_FACE },
+	{ 30, 31, 0, WIRE_NO_FACE },
+	{ 32, 33, 1, WIRE_NO_FACE },
+	{ 33, 34, 1, WIRE_NO_FACE },
+	{ 34, 35, 1, WIRE_NO_FACE },
+	{ 35, 36, 1, WIRE_NO_FACE },
+	{ 37, 38, 1, WIRE_NO_FACE },
+	{ 39, 40, 1, WIRE_NO_FACE },
+	{ 40, 41, 1, WIRE_NO_FACE },
+	{ 42, 43, 1, WIRE_NO_FACE },
+	{ 43, 44, 1, WIRE_NO_FACE },
+	{ 44, 45, 1, WIRE_NO_FACE },
+	{ 46, 47, 1, WIRE_NO_FACE },
+	{ 48, 49, 1, WIRE_NO_FACE },
+	{ 49, 50, 1, WIRE_NO_FACE },
+	{ 50, 51, 1, WIRE_NO_FACE },
+	{ 51, 52, 1, WIRE_NO_FACE },
+	{ 53, 54, 1, WIRE_NO_FACE },
+	{ 55, 56, 1, WIRE_NO_FACE },
+	{ 57, 58, 1, WIRE_NO_FACE },
+	{ 59, 60, 1, WIRE_NO_FACE },
+	{ 60, 61, 1, WIRE_NO_FACE },
+	{ 61, 59, 1, WIRE_NO_FACE },
+	{ 62, 63, 1, WIRE_NO_FACE },
+	{ 0, 32, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 1, 33, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 2, 34, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 3, 35, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 4, 36, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 5, 37, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 6, 38, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 7, 39, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 8, 40, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 9, 41, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 10, 42, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 11, 43, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 12, 44, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 13, 45, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 14, 46, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 15, 47, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 16, 48, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 17, 49, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 18, 50, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 19, 51, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 20, 52, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 21, 53, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 22, 54, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 23, 55, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 24, 56, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 25, 57, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 26, 58, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 27, 59, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 28, 60, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 29, 61, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 30, 62, WIRE_NO_FACE, WIRE_NO_FACE },
+	{ 31, 63, WIRE_NO_FACE, WIRE_NO_FACE },
+};
+
+static const wire_face_t PROGMEM alert_faces[] = {
+	{ 0, 27, 2 },
+	{ 32, 34, 59 },
+};
+
+
+const wire_model_t PROGMEM wire_alert = {
+	.vertices = alert_vertices,
+	.edges = alert_edges,
+	.faces = alert_faces,
+	.num_vertices = sizeof(alert_vertices) / sizeof(*alert_vertices),
+	.num_edges = sizeof(alert_edges) / sizeof(*alert_edges),
+	.num_faces = sizeof(alert_faces) / sizeof(*alert_faces),
+};
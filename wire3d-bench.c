@@ -0,0 +1,265 @@
+/** \file
+ * Host check and cost of the wireframe 3D pipeline.
+ *
+ *	make wire3d-bench
+ *	./wire3d-bench
+ *
+ * vector.c is linked in with the DAC ports and _delay_us() provided
+ * here, so the time each frame would take on the scope is the sum of
+ * the delays that line() makes, the 5 us steps along with the
+ * settling time of each jump.  The cost of the arithmetic is timed on
+ * the host.
+ *
+ * Every projected vertex on the screen is compared with a double
+ * precision projection and every face test with the sign of the exact
+ * normal.  Exits non-zero if a vertex is more than a pixel out or a
+ * face test disagrees with one that is not edge on.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "wire3d.h"
+
+/** Enough for the largest built in model */
+#define CACHE_SIZE	WIRE_ALERT_VERTICES
+
+/** Copies of the text drawn at once for the heavier load */
+#define COPIES		4
+
+
+volatile uint8_t PORTB;
+volatile uint8_t PORTD;
+
+static unsigned long steps;
+static double scope_us;
+
+
+/** Called by vector.c; the per step delays are the ones of 5 or 7 us */
+void
+_delay_us(
+	double us
+)
+{
+	scope_us += us;
+	if (us == 5 || us == 7)
+		steps++;
+}
+
+
+static double
+now_ns(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+
+/** The attract screen's motion at frame i */
+static void
+attract_matrix(
+	wire_matrix_t * const m,
+	const unsigned i
+)
+{
+	wire_identity(m);
+	wire_rotate_y(m, i * 300);
+	wire_rotate_x(m, fix_sin(i * 200) / 4);
+	wire_translate(m, 0, 0, WIRE_UNITS(160) + fix_sin(i * 150) / 16);
+}
+
+
+/** The same matrix in double precision, applied to a vertex */
+static void
+exact_view(
+	const unsigned i,
+	const wire_vertex_t * const v,
+	double * const out
+)
+{
+	const double ay = (uint16_t) (i * 300) * 2 * M_PI / 65536;
+	const double ax = (uint16_t) (fix_sin(i * 200) / 4) * 2 * M_PI / 65536;
+	const double dz = WIRE_UNITS(160) + fix_sin(i * 150) / 16;
+
+	// rotate about y, then about x
+	const double x1 = cos(ay) * v->x + sin(ay) * v->z;
+	const double y1 = v->y;
+	const double z1 = -sin(ay) * v->x + cos(ay) * v->z;
+
+	out[0] = x1 * (1 << WIRE_FRAC);
+	out[1] = (cos(ax) * y1 - sin(ax) * z1) * (1 << WIRE_FRAC);
+	out[2] = (sin(ax) * y1 + cos(ax) * z1) * (1 << WIRE_FRAC) + dz;
+}
+
+
+static int
+accuracy(
+	const char * const name,
+	const wire_model_t * const model,
+	const wire_camera_t * const cam
+)
+{
+	wire_point_t cache[CACHE_SIZE];
+	double worst = 0;
+	double sum2 = 0;
+	unsigned long n = 0;
+	unsigned long face_wrong = 0;
+	unsigned long faces_seen = 0;
+
+	for (unsigned i = 0 ; i < 1024 ; i++)
+	{
+		wire_matrix_t m;
+		attract_matrix(&m, i);
+		wire_transform(model, &m, cam, cache);
+
+		double exact[CACHE_SIZE][3];
+		for (unsigned j = 0 ; j < model->num_vertices ; j++)
+		{
+			const wire_vertex_t * const v = &model->vertices[j];
+			double * const e = exact[j];
+			exact_view(i, v, e);
+
+			// only on screen, since off it the error grows
+			// with the distance
+			if (cache[j].code)
+				continue;
+
+			const double sx = cam->cx + e[0] * cam->focal / e[2];
+			const double sy = cam->cy + e[1] * cam->focal / e[2];
+			const double err = hypot(cache[j].x - sx, cache[j].y - sy);
+
+			sum2 += err * err;
+			if (err > worst)
+				worst = err;
+			n++;
+		}
+
+		// the face faces the viewer if its normal points back
+		// along the view ray
+		for (unsigned f = 0 ; f < model->num_faces ; f++)
+		{
+			const wire_face_t * const face = &model->faces[f];
+			const double * const p0 = exact[face->v0];
+			const double * const p1 = exact[face->v1];
+			const double * const p2 = exact[face->v2];
+			const double a[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+			const double b[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+			const double nrm[3] = {
+				a[1] * b[2] - a[2] * b[1],
+				a[2] * b[0] - a[0] * b[2],
+				a[0] * b[1] - a[1] * b[0],
+			};
+			const double dot = nrm[0] * p0[0] + nrm[1] * p0[1] + nrm[2] * p0[2];
+			const double len = sqrt(nrm[0] * nrm[0] + nrm[1] * nrm[1] + nrm[2] * nrm[2])
+				* sqrt(p0[0] * p0[0] + p0[1] * p0[1] + p0[2] * p0[2]);
+
+			const wire_point_t * const q0 = &cache[face->v0];
+			const wire_point_t * const q1 = &cache[face->v1];
+			const wire_point_t * const q2 = &cache[face->v2];
+
+			// skip faces within a degree of edge on, and those
+			// that wire_draw() takes as visible since they are
+			// partly behind the viewer
+			if (fabs(dot) < len * 0.0175
+			|| (q0->code | q1->code | q2->code) & WIRE_BEHIND)
+				continue;
+			const long cross = (long) (q1->x - q0->x) * (q2->y - q0->y)
+				- (long) (q1->y - q0->y) * (q2->x - q0->x);
+
+			faces_seen += dot > 0;
+			if ((cross > 0) != (dot > 0))
+				face_wrong++;
+		}
+	}
+
+	const int ok = worst <= 1.0 && face_wrong == 0;
+	printf("%s: %-6s worst %.3f rms %.3f px, %lu visible faces, %lu wrong\n",
+		ok ? "ok  " : "FAIL",
+		name,
+		worst,
+		sqrt(sum2 / n),
+		faces_seen,
+		face_wrong
+	);
+
+	return !ok;
+}
+
+
+static void
+costs(
+	const char * const name,
+	const wire_model_t * const model,
+	const wire_camera_t * const cam,
+	const unsigned copies
+)
+{
+	const unsigned frames = 4096;
+	wire_point_t cache[CACHE_SIZE];
+	unsigned long drawn = 0;
+	double transform_ns = 0;
+	double draw_ns = 0;
+
+	steps = 0;
+	scope_us = 0;
+
+	for (unsigned i = 0 ; i < frames ; i++)
+	{
+		for (unsigned c = 0 ; c < copies ; c++)
+		{
+			wire_matrix_t m;
+			attract_matrix(&m, i + c * 100);
+			wire_translate(&m,
+				copies > 1 ? WIRE_UNITS(c & 1 ? 40 : -40) : 0,
+				copies > 1 ? WIRE_UNITS(c & 2 ? 40 : -40) : 0,
+				copies > 1 ? WIRE_UNITS(200) : 0
+			);
+
+			const double t0 = now_ns();
+			const uint8_t off = wire_transform(model, &m, cam, cache);
+			const double t1 = now_ns();
+			if (!off)
+				drawn += wire_draw(model, cache);
+			const double t2 = now_ns();
+
+			transform_ns += t1 - t0;
+			draw_ns += t2 - t1;
+		}
+	}
+
+	const double frame_ms = scope_us / frames / 1000;
+
+	printf("%-6s x%u: %4lu of %4u edges drawn, %5.0f steps, %5.2f ms/frame on the scope, %4.0f Hz\n",
+		name,
+		copies,
+		drawn / frames,
+		model->num_edges * copies,
+		(double) steps / frames,
+		frame_ms,
+		1000 / frame_ms
+	);
+	printf("        transform %.0f ns/vertex, draw %.0f ns/edge on the host\n",
+		transform_ns / frames / copies / model->num_vertices,
+		draw_ns / frames / copies / model->num_edges
+	);
+}
+
+
+int
+main(void)
+{
+	const wire_camera_t cam = { .cx = 128, .cy = 128, .focal = 256 };
+	int failed = 0;
+
+	failed |= accuracy("cube", &wire_cube, &cam);
+	failed |= accuracy("alert", &wire_alert, &cam);
+
+	printf("\n");
+	costs("cube", &wire_cube, &cam, 1);
+	costs("alert", &wire_alert, &cam, 1);
+	costs("alert", &wire_alert, &cam, COPIES);
+
+	return failed;
+}
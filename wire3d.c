@@ -0,0 +1,600 @@
+/** \file
+ * Wireframe 3D models drawn with line().
+ */
+#include <stdint.h>
+#include "wire3d.h"
+#include "vector.h"
+#include "memspaces.h"
+
+/** Models have at most 255 vertices, so this is never an index */
+#define NO_VERTEX	0xFF
+
+
+/** 2^23 / m for m from 256 to 512:
+perl -e 'printf "\t%.0f,\n", 8388608 / $_ for 256..512'
+ * Depths are shifted down to nine bits to index it, which leaves the
+ * reciprocal good to one part in 512.
+ */
+static const uint16_t PROGMEM wire_recip[] = {
+	32768,
+	32640,
+	32514,
+	32388,
+	32264,
+	32140,
+	32018,
+	31896,
+	31775,
+	31655,
+	31536,
+	31418,
+	31301,
+	31184,
+	31069,
+	30954,
+	30840,
+	30728,
+	30615,
+	30504,
+	30394,
+	30284,
+	30175,
+	30067,
+	29959,
+	29853,
+	29747,
+	29642,
+	29537,
+	29434,
+	29331,
+	29229,
+	29127,
+	29026,
+	28926,
+	28827,
+	28728,
+	28630,
+	28533,
+	28436,
+	28340,
+	28244,
+	28150,
+	28056,
+	27962,
+	27869,
+	27777,
+	27685,
+	27594,
+	27504,
+	27414,
+	27324,
+	27236,
+	27148,
+	27060,
+	26973,
+	26887,
+	26801,
+	26715,
+	26631,
+	26546,
+	26462,
+	26379,
+	26297,
+	26214,
+	26133,
+	26052,
+	25971,
+	25891,
+	25811,
+	25732,
+	25653,
+	25575,
+	25497,
+	25420,
+	25343,
+	25267,
+	25191,
+	25116,
+	25041,
+	24966,
+	24892,
+	24818,
+	24745,
+	24672,
+	24600,
+	24528,
+	24457,
+	24385,
+	24315,
+	24245,
+	24175,
+	24105,
+	24036,
+	23967,
+	23899,
+	23831,
+	23764,
+	23697,
+	23630,
+	23564,
+	23498,
+	23432,
+	23367,
+	23302,
+	23237,
+	23173,
+	23109,
+	23046,
+	22982,
+	22920,
+	22857,
+	22795,
+	22733,
+	22672,
+	22611,
+	22550,
+	22490,
+	22429,
+	22370,
+	22310,
+	22251,
+	22192,
+	22134,
+	22075,
+	22017,
+	21960,
+	21902,
+	21845,
+	21789,
+	21732,
+	21676,
+	21620,
+	21565,
+	21509,
+	21454,
+	21400,
+	21345,
+	21291,
+	21237,
+	21183,
+	21130,
+	21077,
+	21024,
+	20972,
+	20919,
+	20867,
+	20815,
+	20764,
+	20713,
+	20662,
+	20611,
+	20560,
+	20510,
+	20460,
+	20410,
+	20361,
+	20311,
+	20262,
+	20214,
+	20165,
+	20117,
+	20068,
+	20021,
+	19973,
+	19925,
+	19878,
+	19831,
+	19784,
+	19738,
+	19692,
+	19645,
+	19600,
+	19554,
+	19508,
+	19463,
+	19418,
+	19373,
+	19329,
+	19284,
+	19240,
+	19196,
+	19152,
+	19108,
+	19065,
+	19022,
+	18979,
+	18936,
+	18893,
+	18851,
+	18809,
+	18766,
+	18725,
+	18683,
+	18641,
+	18600,
+	18559,
+	18518,
+	18477,
+	18437,
+	18396,
+	18356,
+	18316,
+	18276,
+	18236,
+	18197,
+	18157,
+	18118,
+	18079,
+	18040,
+	18001,
+	17963,
+	17924,
+	17886,
+	17848,
+	17810,
+	17772,
+	17735,
+	17697,
+	17660,
+	17623,
+	17586,
+	17549,
+	17513,
+	17476,
+	17440,
+	17404,
+	17368,
+	17332,
+	17296,
+	17261,
+	17225,
+	17190,
+	17155,
+	17120,
+	17085,
+	17050,
+	17015,
+	16981,
+	16947,
+	16913,
+	16878,
+	16845,
+	16811,
+	16777,
+	16744,
+	16710,
+	16677,
+	16644,
+	16611,
+	16578,
+	16546,
+	16513,
+	16481,
+	16448,
+	16416,
+	16384,
+};
+
+
+static inline int16_t
+saturate(
+	const int32_t x
+)
+{
+	return x > INT16_MAX ? INT16_MAX : x < -INT16_MAX ? -INT16_MAX : x;
+}
+
+
+/** m = r * m, with r in Q14 */
+static void
+wire_mul(
+	wire_matrix_t * const m,
+	const int16_t r[3][3]
+)
+{
+	const wire_matrix_t a = *m;
+
+	for (uint8_t i = 0 ; i < 3 ; i++)
+	{
+		for (uint8_t j = 0 ; j < 3 ; j++)
+		{
+			const int32_t sum = (int32_t) r[i][0] * a.m[0][j]
+				+ (int32_t) r[i][1] * a.m[1][j]
+				+ (int32_t) r[i][2] * a.m[2][j];
+
+			m->m[i][j] = saturate((sum + (1L << (FIX_SHIFT - 1))) >> FIX_SHIFT);
+		}
+
+		const int32_t t = (int32_t) r[i][0] * a.t[0]
+			+ (int32_t) r[i][1] * a.t[1]
+			+ (int32_t) r[i][2] * a.t[2];
+
+		m->t[i] = saturate((t + (1L << (FIX_SHIFT - 1))) >> FIX_SHIFT);
+	}
+}
+
+
+void
+wire_identity(
+	wire_matrix_t * const m
+)
+{
+	for (uint8_t i = 0 ; i < 3 ; i++)
+	{
+		for (uint8_t j = 0 ; j < 3 ; j++)
+			m->m[i][j] = i == j ? FIX_ONE : 0;
+		m->t[i] = 0;
+	}
+}
+
+
+void
+wire_rotate_x(
+	wire_matrix_t * const m,
+	const uint16_t angle
+)
+{
+	const int16_t s = fix_sin(angle);
+	const int16_t c = fix_cos(angle);
+	const int16_t r[3][3] = {
+		{ FIX_ONE, 0, 0 },
+		{ 0, c, -s },
+		{ 0, s, c },
+	};
+
+	wire_mul(m, r);
+}
+
+
+void
+wire_rotate_y(
+	wire_matrix_t * const m,
+	const uint16_t angle
+)
+{
+	const int16_t s = fix_sin(angle);
+	const int16_t c = fix_cos(angle);
+	const int16_t r[3][3] = {
+		{ c, 0, s },
+		{ 0, FIX_ONE, 0 },
+		{ -s, 0, c },
+	};
+
+	wire_mul(m, r);
+}
+
+
+void
+wire_rotate_z(
+	wire_matrix_t * const m,
+	const uint16_t angle
+)
+{
+	const int16_t s = fix_sin(angle);
+	const int16_t c = fix_cos(angle);
+	const int16_t r[3][3] = {
+		{ c, -s, 0 },
+		{ s, c, 0 },
+		{ 0, 0, FIX_ONE },
+	};
+
+	wire_mul(m, r);
+}
+
+
+void
+wire_scale(
+	wire_matrix_t * const m,
+	const int16_t s
+)
+{
+	for (uint8_t i = 0 ; i < 3 ; i++)
+	{
+		for (uint8_t j = 0 ; j < 3 ; j++)
+			m->m[i][j] = saturate(((int32_t) m->m[i][j] * s + 128) >> 8);
+		m->t[i] = saturate(((int32_t) m->t[i] * s + 128) >> 8);
+	}
+}
+
+
+void
+wire_translate(
+	wire_matrix_t * const m,
+	const int16_t dx,
+	const int16_t dy,
+	const int16_t dz
+)
+{
+	m->t[0] = saturate((int32_t) m->t[0] + dx);
+	m->t[1] = saturate((int32_t) m->t[1] + dy);
+	m->t[2] = saturate((int32_t) m->t[2] + dz);
+}
+
+
+/** One row of the matrix applied to a vertex, in view units */
+static inline int32_t
+wire_row(
+	const wire_matrix_t * const m,
+	const uint8_t i,
+	const int8_t x,
+	const int8_t y,
+	const int8_t z
+)
+{
+	const int32_t sum = (int32_t) m->m[i][0] * x
+		+ (int32_t) m->m[i][1] * y
+		+ (int32_t) m->m[i][2] * z;
+
+	return ((sum + (1L << (FIX_SHIFT - WIRE_FRAC - 1))) >> (FIX_SHIFT - WIRE_FRAC)) + m->t[i];
+}
+
+
+uint8_t
+wire_transform(
+	const wire_model_t * const model,
+	const wire_matrix_t * const m,
+	const wire_camera_t * const cam,
+	wire_point_t * const cache
+)
+{
+	const wire_vertex_t * const vertices = pgm_read_ptr(&model->vertices);
+	const uint8_t n = pgm_read_byte(&model->num_vertices);
+	const uint16_t focal = cam->focal;
+	uint8_t all = 0xFF;
+
+	for (uint8_t i = 0 ; i < n ; i++)
+	{
+		wire_point_t * const p = &cache[i];
+		const int8_t vx = pgm_read_byte(&vertices[i].x);
+		const int8_t vy = pgm_read_byte(&vertices[i].y);
+		const int8_t vz = pgm_read_byte(&vertices[i].z);
+
+		const int32_t z = wire_row(m, 2, vx, vy, vz);
+		if (z < WIRE_NEAR)
+		{
+			p->x = p->y = 0;
+			all &= p->code = WIRE_BEHIND;
+			continue;
+		}
+
+		const int16_t x = saturate(wire_row(m, 0, vx, vy, vz));
+		const int16_t y = saturate(wire_row(m, 1, vx, vy, vz));
+
+		// z is m * 2^shift, with m from 256 to 512
+		uint8_t shift = 0;
+		while ((z >> shift) >= 512)
+			shift++;
+		const uint16_t mant = (z + ((1L << shift) >> 1)) >> shift;
+
+		// focal * 2^13 / m, for the whole divide to be one more
+		// multiply and shift per axis
+		const uint16_t k = ((uint32_t) focal * pgm_read_word(&wire_recip[mant - 256])) >> 10;
+		const uint8_t down = 13 + shift;
+		const int32_t half = 1L << (down - 1);
+		const int32_t sx = ((int32_t) x * k + half) >> down;
+		const int32_t sy = ((int32_t) y * k + half) >> down;
+
+		if (sx < -WIRE_FAR || sx > WIRE_FAR
+		||  sy < -WIRE_FAR || sy > WIRE_FAR)
+		{
+			p->x = p->y = 0;
+			all &= p->code = WIRE_BEHIND;
+			continue;
+		}
+
+		p->x = cam->cx + sx;
+		p->y = cam->cy + sy;
+		all &= p->code = clip_code(p->x, p->y);
+	}
+
+	return all;
+}
+
+
+/** A face is visible if it winds anticlockwise on the screen.  Faces
+ * with a vertex behind the viewer are counted as visible, since their
+ * edges are dropped anyway.
+ */
+static uint8_t
+face_visible(
+	const wire_face_t * const f,
+	const wire_point_t * const cache
+)
+{
+	const wire_point_t * const p0 = &cache[pgm_read_byte(&f->v0)];
+	const wire_point_t * const p1 = &cache[pgm_read_byte(&f->v1)];
+	const wire_point_t * const p2 = &cache[pgm_read_byte(&f->v2)];
+
+	if ((p0->code | p1->code | p2->code) & WIRE_BEHIND)
+		return 1;
+
+	const int32_t cross
+		= (int32_t) (p1->x - p0->x) * (p2->y - p0->y)
+		- (int32_t) (p1->y - p0->y) * (p2->x - p0->x);
+
+	return cross > 0;
+}
+
+
+uint16_t
+wire_draw(
+	const wire_model_t * const model,
+	const wire_point_t * const cache
+)
+{
+	const wire_edge_t * const edges = pgm_read_ptr(&model->edges);
+	const wire_face_t * const faces = pgm_read_ptr(&model->faces);
+	const uint16_t num_edges = pgm_read_word(&model->num_edges);
+	uint8_t num_faces = pgm_read_byte(&model->num_faces);
+	uint8_t visible[WIRE_MAX_FACES / 8];
+
+	if (num_faces > WIRE_MAX_FACES)
+		num_faces = WIRE_MAX_FACES;
+
+	for (uint8_t i = 0 ; i < num_faces ; i++)
+	{
+		if (face_visible(&faces[i], cache))
+			visible[i / 8] |= 1 << (i % 8);
+		else
+			visible[i / 8] &= ~(1 << (i % 8));
+	}
+
+	uint16_t drawn = 0;
+	uint8_t last = NO_VERTEX;
+
+	for (uint16_t i = 0 ; i < num_edges ; i++)
+	{
+		const wire_edge_t * const e = &edges[i];
+		const uint8_t f0 = pgm_read_byte(&e->f0);
+		const uint8_t f1 = pgm_read_byte(&e->f1);
+
+		// edges with no faces are always drawn
+		if (f0 != WIRE_NO_FACE || f1 != WIRE_NO_FACE)
+		{
+			const uint8_t v0 = f0 < num_faces
+				&& visible[f0 / 8] & (1 << (f0 % 8));
+			const uint8_t v1 = f1 < num_faces
+				&& visible[f1 / 8] & (1 << (f1 % 8));
+			if (!v0 && !v1)
+				continue;
+		}
+
+		uint8_t a = pgm_read_byte(&e->v0);
+		uint8_t b = pgm_read_byte(&e->v1);
+		const uint8_t ca = cache[a].code;
+		const uint8_t cb = cache[b].code;
+
+		// trivial reject, which includes both behind the viewer
+		if ((ca & cb) || ((ca | cb) & WIRE_BEHIND))
+			continue;
+
+		if ((ca | cb) == 0)
+		{
+			// keep the beam going along paths that were
+			// listed backwards
+			if (b == last)
+			{
+				b = a;
+				a = last;
+			}
+
+			line(cache[a].x, cache[a].y, cache[b].x, cache[b].y);
+			last = b;
+		} else {
+			int16_t x0 = cache[a].x;
+			int16_t y0 = cache[a].y;
+			int16_t x1 = cache[b].x;
+			int16_t y1 = cache[b].y;
+
+			if (!line_clip(&x0, &y0, ca, &x1, &y1, cb))
+				continue;
+
+			line(x0, y0, x1, y1);
+			last = NO_VERTEX;
+		}
+
+		drawn++;
+	}
+
+	return drawn;
+}
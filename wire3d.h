@@ -0,0 +1,207 @@
+/** \file
+ * Wireframe 3D models drawn with line().
+ *
+ * A model is a table of 8-bit vertices, a table of edges between
+ * them and an optional table of faces, all in program memory.  Each
+ * frame the vertices go through a fixed point 3x4 matrix and a
+ * perspective divide into a caller supplied cache, once each however
+ * many edges share them, and then the edges are drawn from the cache.
+ *
+ * The view looks along +z from the origin with +y up.  Positions in
+ * view space have WIRE_FRAC bits of fraction over the model units,
+ * so that small models can still move smoothly.  The perspective
+ * divide is a multiply by a reciprocal from a table, normalised so
+ * it is good to a fifth of a percent at any depth.
+ *
+ * Edges with both ends off the same side of the screen are rejected
+ * without any more work and those that cross the edge are clipped.
+ * Vertices in front of the near plane are not clipped in 3D; any
+ * edge that uses one is dropped.  An edge may name the faces on either
+ * side of it, and is then only drawn if one of them faces the viewer,
+ * which hides the back of closed models.
+ */
+#ifndef _wire3d_h_
+#define _wire3d_h_
+
+#include <stdint.h>
+#include "fixmath.h"
+
+/** Fraction bits of view space positions */
+#define WIRE_FRAC	5
+
+/** View units for a number of model units */
+#define WIRE_UNITS(u)	((int16_t) ((u) * (1 << WIRE_FRAC)))
+
+/** Closest depth that is drawn, in view units */
+#define WIRE_NEAR	WIRE_UNITS(16)
+
+/** Projected points further than this from the screen are treated
+ * as being in front of the near plane, so that the clipping and the
+ * face tests fit in 32 bits.
+ */
+#define WIRE_FAR	8192
+
+/** Most faces in a model, for the visibility bitmap */
+#define WIRE_MAX_FACES	128
+
+/** Edges without a face on one or both sides */
+#define WIRE_NO_FACE	0xFF
+
+/** Out code of a projected vertex that is in front of the near
+ * plane, along with the CLIP_ codes from vector.h for the rest.
+ */
+#define WIRE_BEHIND	0x10
+
+
+typedef struct
+{
+	int8_t x;
+	int8_t y;
+	int8_t z;
+} wire_vertex_t;
+
+
+/** An edge with faces is drawn if either of them is visible.
+ * Edges with WIRE_NO_FACE for both are always drawn.
+ */
+typedef struct
+{
+	uint8_t v0;
+	uint8_t v1;
+	uint8_t f0;
+	uint8_t f1;
+} wire_edge_t;
+
+
+/** Three vertices of each face, anticlockwise when seen from the
+ * front.  The rest of the face must be in the same plane.
+ */
+typedef struct
+{
+	uint8_t v0;
+	uint8_t v1;
+	uint8_t v2;
+} wire_face_t;
+
+
+/** Stored in program memory, like the tables it points to */
+typedef struct
+{
+	const wire_vertex_t * vertices;
+	const wire_edge_t * edges;
+	const wire_face_t * faces;
+	uint8_t num_vertices;
+	uint16_t num_edges;
+	uint8_t num_faces;
+} wire_model_t;
+
+
+/** Rotation and scale in Q14, and a translation in view units */
+typedef struct
+{
+	int16_t m[3][3];
+	int16_t t[3];
+} wire_matrix_t;
+
+
+typedef struct
+{
+	uint8_t cx; // screen position of the view axis
+	uint8_t cy;
+	uint16_t focal; // pixels for a slope of one, up to 1023
+} wire_camera_t;
+
+
+/** One entry of the vertex cache */
+typedef struct
+{
+	int16_t x;
+	int16_t y;
+	uint8_t code;
+} wire_point_t;
+
+
+/** Built in models, and the cache each one needs */
+#define WIRE_CUBE_VERTICES	8
+#define WIRE_ALERT_VERTICES	64
+
+extern const wire_model_t wire_cube;
+extern const wire_model_t wire_alert;
+
+
+/*
+ * Matrices are built from the identity by applying operations in the
+ * order the vertices should see them, as with xform.h.  Angles are
+ * 16-bit as fix_sin() and rotate anticlockwise when looking down
+ * the axis towards the origin.
+ */
+extern void
+wire_identity(
+	wire_matrix_t * m
+);
+
+
+extern void
+wire_rotate_x(
+	wire_matrix_t * m,
+	uint16_t angle
+);
+
+
+extern void
+wire_rotate_y(
+	wire_matrix_t * m,
+	uint16_t angle
+);
+
+
+extern void
+wire_rotate_z(
+	wire_matrix_t * m,
+	uint16_t angle
+);
+
+
+/** Scale by a Q8 factor.  The matrix saturates at just under two. */
+extern void
+wire_scale(
+	wire_matrix_t * m,
+	int16_t s
+);
+
+
+/** Move by a number of view units */
+extern void
+wire_translate(
+	wire_matrix_t * m,
+	int16_t dx,
+	int16_t dy,
+	int16_t dz
+);
+
+
+/** Transform and project every vertex of a model into the cache,
+ * which must have room for all of them.  Returns the out codes of all
+ * of the vertices and'ed together, which is non-zero if the whole
+ * model is off the screen.
+ */
+extern uint8_t
+wire_transform(
+	const wire_model_t * model,
+	const wire_matrix_t * m,
+	const wire_camera_t * cam,
+	wire_point_t * cache
+);
+
+
+/** Draw the visible edges of a model from the cache filled in by
+ * wire_transform(), and return how many were drawn.
+ */
+extern uint16_t
+wire_draw(
+	const wire_model_t * model,
+	const wire_point_t * cache
+);
+
+
+#endif
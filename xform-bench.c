@@ -0,0 +1,290 @@
+/** \file
+ * Host benchmark of the affine transforms against vector_rot_x/y.
+ *
+ *	make xform-bench
+ *	./xform-bench
+ *
+ * Glyph sized batches of 8-bit points are rotated and scaled for every
+ * angle at several scales, with the old per-point vector_rot_x() and
+ * vector_rot_y(), copied here since vector.c only builds for the AVR,
+ * and with an xform_t built once per batch.  Both are compared with
+ * the exact double precision result and timed per point; the build of
+ * the transform is counted in the xform time.
+ *
+ * Exits non-zero if the transform is ever more than a pixel out.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "xform.h"
+#include "sin_table.h"
+#include "xorshift.h"
+
+#define POINTS		48 // GLYPH_MAX_POINTS
+#define BATCHES		64
+
+
+/** vector_rot_t and its functions as in vector.c */
+typedef struct
+{
+	uint8_t cx;
+	uint8_t cy;
+	int8_t scale;
+	uint8_t theta;
+	int8_t sin_t;
+	int8_t cos_t;
+} vector_rot_t;
+
+
+static void
+vector_rot_init(
+	vector_rot_t * r,
+	uint8_t theta
+)
+{
+	r->theta = theta;
+	r->sin_t = sin_lookup(theta);
+	r->cos_t = cos_lookup(theta);
+}
+
+
+static uint8_t
+vector_rot_x(
+	const vector_rot_t * r,
+	int8_t x,
+	int8_t y
+)
+{
+	int32_t x2 = x;
+	int32_t w;
+	if (r->theta != 0)
+	{
+		int32_t y2 = y;
+
+		w = (r->scale * (x2 * r->cos_t + y2 * r->sin_t)) / (32 * 256);
+	} else {
+		w = (r->scale * x2) / 64;
+	}
+
+	return w + r->cx;
+}
+
+
+static uint8_t
+vector_rot_y(
+	const vector_rot_t * r,
+	int8_t x,
+	int8_t y
+)
+{
+	int32_t x2 = x;
+	int32_t y2 = y;
+	int32_t z;
+
+	if (r->theta != 0)
+		z = (r->scale * (y2 * r->cos_t - x2 * r->sin_t)) / (32 * 256);
+	else
+		z = (r->scale * y2) / 64;
+
+	return z + r->cy;
+}
+
+
+/** The same transform as rot_xform() in vector.c, for a glyph at 0,0 */
+static void
+rot_xform(
+	const vector_rot_t * const r,
+	xform_t * const m
+)
+{
+	xform_identity(m);
+	xform_scale(m, r->scale * 4, r->scale * 4);
+	if (r->theta != 0)
+		xform_rotate(m, -((uint16_t) r->theta << 8));
+	xform_translate(m, r->cx, r->cy);
+}
+
+
+static int8_t px[BATCHES][POINTS];
+static int8_t py[BATCHES][POINTS];
+static vec2_t sp[POINTS];
+static volatile uint32_t sink;
+
+
+static double
+now_ns(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+
+/** Distance from the exact position, in pixels */
+static double
+error(
+	const vector_rot_t * const r,
+	const int8_t x,
+	const int8_t y,
+	const uint8_t gx,
+	const uint8_t gy
+)
+{
+	const double t = r->theta * 2 * M_PI / 256;
+	const double k = r->scale / 64.0;
+	const double ex = r->cx + k * (x * cos(t) + y * sin(t));
+	const double ey = r->cy + k * (y * cos(t) - x * sin(t));
+
+	return hypot(gx - ex, gy - ey);
+}
+
+
+int
+main(void)
+{
+	static const int8_t scales[] = { 16, 32, 48, 64, 96, 127 };
+	xorshift_t rng;
+	int failed = 0;
+
+	xorshift_seed(&rng, 1);
+	for (unsigned b = 0 ; b < BATCHES ; b++)
+	{
+		for (unsigned i = 0 ; i < POINTS ; i++)
+		{
+			px[b][i] = (int8_t) (xorshift_below(&rng, 81) - 40);
+			py[b][i] = (int8_t) (xorshift_below(&rng, 81) - 40);
+		}
+	}
+
+	printf("%5s %10s %10s %10s %10s %9s %9s\n",
+		"scale",
+		"rot worst",
+		"rot rms",
+		"xf worst",
+		"xf rms",
+		"rot ns/pt",
+		"xf ns/pt"
+	);
+
+	for (unsigned s = 0 ; s < sizeof(scales) ; s++)
+	{
+		vector_rot_t r = { .cx = 128, .cy = 128, .scale = scales[s] };
+		double worst_r = 0;
+		double worst_x = 0;
+		double sum2_r = 0;
+		double sum2_x = 0;
+		unsigned long n = 0;
+
+		// accuracy over every angle
+		for (unsigned theta = 0 ; theta < 256 ; theta++)
+		{
+			vector_rot_init(&r, theta);
+			xform_t m;
+			rot_xform(&r, &m);
+
+			for (unsigned b = 0 ; b < BATCHES ; b++)
+			{
+				xform_points8(&m, px[b], py[b], POINTS, sp);
+
+				for (unsigned i = 0 ; i < POINTS ; i++)
+				{
+					const double er = error(&r, px[b][i], py[b][i],
+						vector_rot_x(&r, px[b][i], py[b][i]),
+						vector_rot_y(&r, px[b][i], py[b][i])
+					);
+					const double ex = error(&r, px[b][i], py[b][i], sp[i].x, sp[i].y);
+
+					sum2_r += er * er;
+					sum2_x += ex * ex;
+					if (er > worst_r)
+						worst_r = er;
+					if (ex > worst_x)
+						worst_x = ex;
+					n++;
+				}
+			}
+		}
+
+		// timing, with the transform built once per batch
+		uint32_t acc = 0;
+		double t0 = now_ns();
+		for (unsigned theta = 0 ; theta < 256 ; theta++)
+		{
+			vector_rot_init(&r, theta);
+			for (unsigned b = 0 ; b < BATCHES ; b++)
+				for (unsigned i = 0 ; i < POINTS ; i++)
+					acc += vector_rot_x(&r, px[b][i], py[b][i])
+						+ vector_rot_y(&r, px[b][i], py[b][i]);
+		}
+		double t1 = now_ns();
+		for (unsigned theta = 0 ; theta < 256 ; theta++)
+		{
+			vector_rot_init(&r, theta);
+			for (unsigned b = 0 ; b < BATCHES ; b++)
+			{
+				xform_t m;
+				rot_xform(&r, &m);
+				xform_points8(&m, px[b], py[b], POINTS, sp);
+				acc += sp[b % POINTS].x + sp[b % POINTS].y;
+			}
+		}
+		double t2 = now_ns();
+		sink = acc;
+
+		const double points = 256.0 * BATCHES * POINTS;
+		printf("%5d %10.3f %10.3f %10.3f %10.3f %9.2f %9.2f\n",
+			scales[s],
+			worst_r,
+			sqrt(sum2_r / n),
+			worst_x,
+			sqrt(sum2_x / n),
+			(t1 - t0) / points,
+			(t2 - t1) / points
+		);
+
+		if (worst_x > 1.0)
+			failed = 1;
+	}
+
+	// composing a full transform and a 16-bit batch
+	vec2_t in[POINTS];
+	vec2_t out[POINTS];
+	for (unsigned i = 0 ; i < POINTS ; i++)
+		in[i] = (vec2_t) { px[0][i] * 100, py[0][i] * 100 };
+
+	const unsigned long reps = 1 << 18;
+	uint32_t acc = 0;
+	double t0 = now_ns();
+	for (unsigned long k = 0 ; k < reps ; k++)
+	{
+		xform_t m;
+		xform_identity(&m);
+		xform_translate(&m, k & 7, 3);
+		xform_scale(&m, 200 + (k & 15), 300);
+		xform_shear(&m, 20, 0);
+		xform_rotate(&m, k * 97);
+		xform_translate(&m, 128, 128);
+		acc += m.a + m.tx;
+	}
+	double t1 = now_ns();
+	xform_t m;
+	xform_identity(&m);
+	xform_scale(&m, 3, 3);
+	xform_rotate(&m, 12345);
+	for (unsigned long k = 0 ; k < reps ; k++)
+	{
+		xform_points(&m, in, out, POINTS);
+		acc += out[k % POINTS].x;
+	}
+	double t2 = now_ns();
+	sink = acc;
+
+	printf("build translate/scale/shear/rotate/translate: %.1f ns\n",
+		(t1 - t0) / reps);
+	printf("xform_points 16-bit: %.2f ns/pt\n",
+		(t2 - t1) / reps / POINTS);
+
+	return failed;
+}
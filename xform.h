@@ -0,0 +1,273 @@
+/** \file
+ * Fixed point 2D vectors and affine transforms.
+ *
+ * A transform maps (x,y) to
+ *
+ *	x' = ((a x + b y) >> shift) + tx
+ *	y' = ((c x + d y) >> shift) + ty
+ *
+ * rounded to the nearest unit.  The coefficients are 16-bit with a
+ * binary point that floats: every operation renormalises them so the
+ * largest is under 2^14 with as many bits as possible, and adjusts
+ * the shift to match.  Both products then fit in 32 bits for any
+ * 16-bit input, so each point costs four 16 by 16 bit multiplies and
+ * one shift per axis, whatever mix of rotation, scale and shear the
+ * transform holds.  The translation is in whole output units.
+ *
+ * Transforms are built from the identity by applying operations in
+ * the order the points should see them; each one acts on the output
+ * of the transform so far.  Building a transform costs a few 32-bit
+ * multiplies and is meant to be done once per object per frame.
+ */
+#ifndef _xform_h_
+#define _xform_h_
+
+#include <stdint.h>
+#include "fixmath.h"
+
+/** Coefficients are kept below 1 << XFORM_BITS */
+#define XFORM_BITS	14
+
+/** Finest binary point, for transforms that shrink a lot */
+#define XFORM_MAX_SHIFT	24
+
+/** Scale and shear factors are Q8 */
+#define XFORM_ONE	256
+
+
+typedef struct
+{
+	int16_t x;
+	int16_t y;
+} vec2_t;
+
+
+typedef struct
+{
+	int16_t a;
+	int16_t b;
+	int16_t c;
+	int16_t d;
+	int16_t tx;
+	int16_t ty;
+	uint8_t shift;
+} xform_t;
+
+
+static inline int32_t
+xform_abs32(
+	const int32_t x
+)
+{
+	return x < 0 ? -x : x;
+}
+
+
+/** Store 32-bit coefficients with a binary point at shift,
+ * renormalised to fit in XFORM_BITS.
+ */
+static inline void
+xform_set(
+	xform_t * const m,
+	int32_t a,
+	int32_t b,
+	int32_t c,
+	int32_t d,
+	uint8_t shift
+)
+{
+	int32_t max = xform_abs32(a) | xform_abs32(b)
+		| xform_abs32(c) | xform_abs32(d);
+
+	uint8_t down = 0;
+	while ((max >> down) >= (1L << XFORM_BITS) || shift - down > XFORM_MAX_SHIFT)
+		down++;
+
+	// scales of 2^14 and more are clamped rather than wrapped
+	const uint8_t clamp = down > shift;
+	if (clamp)
+		down = shift;
+
+	if (down)
+	{
+		const int32_t half = 1L << (down - 1);
+		a = (a + half) >> down;
+		b = (b + half) >> down;
+		c = (c + half) >> down;
+		d = (d + half) >> down;
+	}
+
+	if (clamp)
+	{
+		const int32_t lim = (1L << XFORM_BITS) - 1;
+		a = a > lim ? lim : a < -lim ? -lim : a;
+		b = b > lim ? lim : b < -lim ? -lim : b;
+		c = c > lim ? lim : c < -lim ? -lim : c;
+		d = d > lim ? lim : d < -lim ? -lim : d;
+	}
+
+	m->a = a;
+	m->b = b;
+	m->c = c;
+	m->d = d;
+	m->shift = shift - down;
+}
+
+
+static inline void
+xform_identity(
+	xform_t * const m
+)
+{
+	m->a = m->d = 1 << (XFORM_BITS - 1);
+	m->b = m->c = 0;
+	m->tx = m->ty = 0;
+	m->shift = XFORM_BITS - 1;
+}
+
+
+/** Half a unit at the transform's binary point, for rounding */
+static inline int32_t
+xform_half(
+	const xform_t * const m
+)
+{
+	return m->shift ? 1L << (m->shift - 1) : 0;
+}
+
+
+static inline vec2_t
+xform_apply(
+	const xform_t * const m,
+	const vec2_t p
+)
+{
+	const int32_t half = xform_half(m);
+	vec2_t q;
+	q.x = (((int32_t) m->a * p.x + (int32_t) m->b * p.y + half) >> m->shift) + m->tx;
+	q.y = (((int32_t) m->c * p.x + (int32_t) m->d * p.y + half) >> m->shift) + m->ty;
+	return q;
+}
+
+
+/** out = second applied after first; out may be either of them */
+static inline void
+xform_mul(
+	xform_t * const out,
+	const xform_t * const second,
+	const xform_t * const first
+)
+{
+	const xform_t m2 = *second;
+	const xform_t m1 = *first;
+
+	// the first translation goes through the second's coefficients
+	const vec2_t t = xform_apply(&m2, (vec2_t) { m1.tx, m1.ty });
+
+	xform_set(out,
+		(int32_t) m2.a * m1.a + (int32_t) m2.b * m1.c,
+		(int32_t) m2.a * m1.b + (int32_t) m2.b * m1.d,
+		(int32_t) m2.c * m1.a + (int32_t) m2.d * m1.c,
+		(int32_t) m2.c * m1.b + (int32_t) m2.d * m1.d,
+		m1.shift + m2.shift
+	);
+	out->tx = t.x;
+	out->ty = t.y;
+}
+
+
+static inline void
+xform_translate(
+	xform_t * const m,
+	const int16_t dx,
+	const int16_t dy
+)
+{
+	m->tx += dx;
+	m->ty += dy;
+}
+
+
+/** Rotate anticlockwise by a 16-bit angle, as fix_sin() */
+static inline void
+xform_rotate(
+	xform_t * const m,
+	const uint16_t angle
+)
+{
+	const int16_t s = fix_sin(angle);
+	const int16_t c = fix_cos(angle);
+	xform_t r = { c, -s, s, c, 0, 0, FIX_SHIFT };
+	xform_mul(m, &r, m);
+}
+
+
+/** Scale by Q8 factors; negative flips that axis */
+static inline void
+xform_scale(
+	xform_t * const m,
+	const int16_t sx,
+	const int16_t sy
+)
+{
+	xform_t s = { sx, 0, 0, sy, 0, 0, 8 };
+	xform_mul(m, &s, m);
+}
+
+
+/** Shear x by kx times y and y by ky times x, Q8 */
+static inline void
+xform_shear(
+	xform_t * const m,
+	const int16_t kx,
+	const int16_t ky
+)
+{
+	xform_t h = { XFORM_ONE, kx, ky, XFORM_ONE, 0, 0, 8 };
+	xform_mul(m, &h, m);
+}
+
+
+static inline void
+xform_points(
+	const xform_t * const m,
+	const vec2_t * const in,
+	vec2_t * const out,
+	const uint8_t n
+)
+{
+	const int32_t half = xform_half(m);
+
+	for (uint8_t i = 0 ; i < n ; i++)
+	{
+		const int16_t x = in[i].x;
+		const int16_t y = in[i].y;
+		out[i].x = (((int32_t) m->a * x + (int32_t) m->b * y + half) >> m->shift) + m->tx;
+		out[i].y = (((int32_t) m->c * x + (int32_t) m->d * y + half) >> m->shift) + m->ty;
+	}
+}
+
+
+/** Transform separate arrays of 8-bit coordinates, such as the
+ * points of a decoded glyph.  out must not overlap the inputs.
+ */
+static inline void
+xform_points8(
+	const xform_t * const m,
+	const int8_t * const x,
+	const int8_t * const y,
+	const uint8_t n,
+	vec2_t * const out
+)
+{
+	const int32_t half = xform_half(m);
+
+	for (uint8_t i = 0 ; i < n ; i++)
+	{
+		out[i].x = (((int32_t) m->a * x[i] + (int32_t) m->b * y[i] + half) >> m->shift) + m->tx;
+		out[i].y = (((int32_t) m->c * x[i] + (int32_t) m->d * y[i] + half) >> m->shift) + m->ty;
+	}
+}
+
+
+#endif
@@ -0,0 +1,136 @@
+/** \file
+ * Host benchmark for the xorshift PRNG.
+ *
+ *	make xorshift-bench
+ *	./xorshift-bench
+ *
+ * Compares xorshift16() with the fastrand() that spacerocks used
+ * before: lrand48() on the host, and two calls to avr-libc's rand()
+ * on the AVR, which is reproduced here.  The bounded helper is
+ * compared with % n for a range that is not a power of two, and its
+ * spread is checked by counting how often each value comes up; the
+ * worst deviation should be a few times the sampling noise.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <math.h>
+#include "xorshift.h"
+
+#define COUNT		(1 << 24)
+#define DRAWS		4096 // per value when checking the spread
+
+/** The avr-libc rand(), Park and Miller's minimal standard generator
+ * with the 32-bit divisions done in Schrage's method.
+ */
+static uint32_t avr_rand_ctx = 1;
+
+static int16_t
+avr_rand(void)
+{
+	int32_t x = avr_rand_ctx;
+	if (x == 0)
+		x = 123459876L;
+
+	const int32_t hi = x / 127773L;
+	const int32_t lo = x % 127773L;
+	x = 16807L * lo - 2836L * hi;
+	if (x < 0)
+		x += 0x7FFFFFFFL;
+
+	avr_rand_ctx = x;
+	return x % 0x8000;
+}
+
+
+/** What fastrand() was on the AVR */
+static uint16_t
+avr_fastrand(void)
+{
+	uint16_t r = avr_rand();
+	r ^= avr_rand() << 1;
+	return r;
+}
+
+
+static double
+elapsed_ns(
+	const struct timespec * const start,
+	const struct timespec * const end
+)
+{
+	return (end->tv_sec - start->tv_sec) * 1e9
+		+ (end->tv_nsec - start->tv_nsec);
+}
+
+
+static xorshift_t rng;
+static volatile uint16_t sink;
+
+#define BENCH(name, expr) do { \
+	struct timespec start, end; \
+	uint16_t sum = 0; \
+	clock_gettime(CLOCK_MONOTONIC, &start); \
+	for (uint32_t i = 0 ; i < COUNT ; i++) \
+		sum += (expr); \
+	clock_gettime(CLOCK_MONOTONIC, &end); \
+	sink = sum; \
+	printf("%-24s %8.2f\n", name, elapsed_ns(&start, &end) / COUNT); \
+} while (0)
+
+
+/** Largest deviation from an even spread, as a fraction */
+static double
+spread(
+	const uint16_t n
+)
+{
+	static uint32_t counts[65536];
+	const uint32_t draws = n * DRAWS;
+
+	for (uint32_t i = 0 ; i < n ; i++)
+		counts[i] = 0;
+	for (uint32_t i = 0 ; i < draws ; i++)
+		counts[xorshift_below(&rng, n)]++;
+
+	double worst = 0;
+	for (uint32_t i = 0 ; i < n ; i++)
+	{
+		const double d = counts[i] * (double) n / draws - 1;
+		if (worst < d)
+			worst = d;
+		if (worst < -d)
+			worst = -d;
+	}
+
+	return worst;
+}
+
+
+int
+main(void)
+{
+	srand48(1);
+	xorshift_seed(&rng, 1);
+
+	printf("%-24s %8s\n", "generator", "ns");
+	BENCH("lrand48()", lrand48());
+	BENCH("avr-libc rand() x2", avr_fastrand());
+	BENCH("xorshift16()", xorshift16(&rng));
+
+	// not a power of two, where % needs a division
+	static volatile uint16_t n = 24;
+	printf("\n%-24s %8s\n", "range 0 to 23", "ns");
+	BENCH("lrand48() % n", lrand48() % n);
+	BENCH("avr-libc rand() x2 % n", avr_fastrand() % n);
+	BENCH("xorshift16() % n", xorshift16(&rng) % n);
+	BENCH("xorshift_below(n)", xorshift_below(&rng, n));
+
+	printf("\n%-24s %8s (noise %.4f)\n", "xorshift_below(n)", "worst", 1 / sqrt(DRAWS));
+	const uint16_t ranges[] = { 2, 24, 128, 1000, 4096 };
+	for (unsigned i = 0 ; i < sizeof(ranges) / sizeof(*ranges) ; i++)
+		printf("%-24u %8.4f\n", ranges[i], spread(ranges[i]));
+
+	return 0;
+}
@@ -0,0 +1,59 @@
+/** \file
+ * Small seedable PRNG that gives the same numbers on the host and AVR.
+ *
+ * Marsaglia's 32-bit xorshift with shifts of 13, 17 and 5, which has a
+ * period of 2^32 - 1 and needs only shifts and xors.  avr-libc's
+ * rand() does a 32-bit division per call.  The top half of the state
+ * is returned, since the low bits of xorshift are the weakest.
+ *
+ * The state is owned by the caller, so that several generators can
+ * run at once.
+ */
+#ifndef _xorshift_h_
+#define _xorshift_h_
+
+#include <stdint.h>
+
+typedef uint32_t xorshift_t;
+
+
+/** Seed the generator.  An all zero state never leaves zero,
+ * so a zero seed is replaced.
+ */
+static inline void
+xorshift_seed(
+	xorshift_t * const x,
+	const uint32_t seed
+)
+{
+	*x = seed ? seed : 0x92D68CA2;
+}
+
+
+static inline uint16_t
+xorshift16(
+	xorshift_t * const x
+)
+{
+	uint32_t v = *x;
+	v ^= v << 13;
+	v ^= v >> 17;
+	v ^= v << 5;
+	*x = v;
+	return v >> 16;
+}
+
+
+/** Uniform in 0 to n-1, scaled with a multiply rather than % n.
+ * The bias is at most n / 65536.
+ */
+static inline uint16_t
+xorshift_below(
+	xorshift_t * const x,
+	const uint16_t n
+)
+{
+	return ((uint32_t) xorshift16(x) * n) >> 16;
+}
+
+#endif